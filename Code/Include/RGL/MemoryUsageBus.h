@@ -0,0 +1,103 @@
+/* Copyright 2024, Robotec.ai sp. z o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <AzCore/Asset/AssetCommon.h>
+#include <AzCore/Component/EntityId.h>
+#include <AzCore/EBus/EBus.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/string/string.h>
+
+namespace RGL
+{
+    //! Number of bytes occupied by RGL scene data, split by the data type.
+    struct MemoryUsage
+    {
+        size_t m_vertexBytes{ 0U };
+        size_t m_indexBytes{ 0U };
+        size_t m_uvBytes{ 0U };
+        size_t m_textureBytes{ 0U };
+        size_t m_rayPoseBytes{ 0U };
+        size_t m_resultBytes{ 0U };
+
+        [[nodiscard]] size_t GetTotalBytes() const
+        {
+            return m_vertexBytes + m_indexBytes + m_uvBytes + m_textureBytes + m_rayPoseBytes + m_resultBytes;
+        }
+
+        MemoryUsage& operator+=(const MemoryUsage& other)
+        {
+            m_vertexBytes += other.m_vertexBytes;
+            m_indexBytes += other.m_indexBytes;
+            m_uvBytes += other.m_uvBytes;
+            m_textureBytes += other.m_textureBytes;
+            m_rayPoseBytes += other.m_rayPoseBytes;
+            m_resultBytes += other.m_resultBytes;
+            return *this;
+        }
+    };
+
+    //! Memory usage of the RGL scene grouped by its consumers.
+    //! Each byte is reported exactly once, by its owner.
+    struct MemoryUsageReport
+    {
+        //! Geometry and textures shared between entities, keyed by the source asset (model or material).
+        AZStd::unordered_map<AZ::Data::AssetId, MemoryUsage> m_assets;
+        //! Data owned by a single entity (e.g. meshes of deformed actors).
+        AZStd::unordered_map<AZ::EntityId, MemoryUsage> m_entities;
+        //! Data tied neither to an asset nor to an entity (e.g. terrain, lidar pipelines).
+        AZStd::unordered_map<AZStd::string, MemoryUsage> m_other;
+
+        [[nodiscard]] MemoryUsage GetTotal() const
+        {
+            MemoryUsage total;
+            for (const auto& [assetId, usage] : m_assets)
+            {
+                total += usage;
+            }
+
+            for (const auto& [entityId, usage] : m_entities)
+            {
+                total += usage;
+            }
+
+            for (const auto& [name, usage] : m_other)
+            {
+                total += usage;
+            }
+
+            return total;
+        }
+    };
+
+    class MemoryUsageRequests : public AZ::EBusTraits
+    {
+    public:
+        //////////////////////////////////////////////////////////////////////////
+        // EBusTraits overrides
+        static constexpr AZ::EBusHandlerPolicy HandlerPolicy = AZ::EBusHandlerPolicy::Multiple;
+        static constexpr AZ::EBusAddressPolicy AddressPolicy = AZ::EBusAddressPolicy::Single;
+        //////////////////////////////////////////////////////////////////////////
+
+        //! Adds the memory used by the handler's RGL objects to the report.
+        //! To obtain the full report of the RGL scene, broadcast this request with an empty report.
+        virtual void CollectMemoryUsage(MemoryUsageReport& report) const = 0;
+
+    protected:
+        ~MemoryUsageRequests() = default;
+    };
+
+    using MemoryUsageRequestBus = AZ::EBus<MemoryUsageRequests>;
+} // namespace RGL
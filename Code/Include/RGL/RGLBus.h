@@ -33,7 +33,9 @@ namespace RGL
         virtual void SetSceneConfiguration(const SceneConfiguration& config) = 0;
         [[nodiscard]] virtual const SceneConfiguration& GetSceneConfiguration() const = 0;
 
-        //! Updates scene to the RGL
+        //! Updates scene to the RGL.
+        //! Called before the lidars tick if any lidar is expected to raycast in the tick. Otherwise, called by the first raycast.
+        //! Subsequent calls within the same tick have no effect.
         virtual void UpdateScene() = 0;
 
     protected:
@@ -16,9 +16,21 @@
 
 #include <Atom/RPI.Reflect/Image/StreamingImageAsset.h>
 #include <AzCore/Asset/AssetCommon.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/string/string.h>
 
 namespace RGL
 {
+    //! Structure used to describe the intensity of terrain surfaces with the provided surface tag.
+    struct SurfaceTagIntensity
+    {
+        AZ_TYPE_INFO(SurfaceTagIntensity, "{9b3e5d17-6c2a-4f48-8e71-d0a4c5b2f963}");
+        static void Reflect(AZ::ReflectContext* context);
+
+        AZStd::string m_surfaceTag;
+        AZ::u8 m_intensity{ 0U };
+    };
+
     //! Structure used to describe global terrain intensity configuration.
     struct TerrainIntensityConfiguration
     {
@@ -28,6 +40,80 @@ namespace RGL
         AZ::Data::Asset<AZ::RPI::StreamingImageAsset> m_colorImageAsset{ AZ::Data::AssetLoadBehavior::QueueLoad };
         AZ::u8 m_defaultValue{ 0U };
         bool m_isTiled{ true };
+        //! If true, the intensity is based on the terrain surface tags instead of the color texture.
+        bool m_isSurfaceTagIntensityEnabled{ false };
+        AZStd::vector<SurfaceTagIntensity> m_surfaceTagIntensities;
+    };
+
+    //! Structure used to describe the triangulation of the terrain mesh.
+    struct TerrainMeshConfiguration
+    {
+        AZ_TYPE_INFO(TerrainMeshConfiguration, "{e4a7c2d9-1b6f-4f83-a05e-9d3c7b2f8e16}");
+        static void Reflect(AZ::ReflectContext* context);
+
+        //! If true, flat parts of the terrain are represented by fewer, larger triangles instead of two triangles per grid sector.
+        bool m_isAdaptive{ false };
+        float m_maxVerticalError{ 0.05f }; //!< Maximal vertical distance (in meters) between the mesh and the heightfield.
+    };
+
+    //! Structure used to describe the streaming of geometry based on the lidar range.
+    struct GeometryStreamingConfiguration
+    {
+        AZ_TYPE_INFO(GeometryStreamingConfiguration, "{3b0f2f8e-5d0c-4d55-a8f4-2e9c1b7d6a41}");
+        static void Reflect(AZ::ReflectContext* context);
+
+        bool m_isEnabled{ false };
+        float m_margin{ 10.0f }; //!< Distance beyond the lidar range within which entities are added to the scene.
+        float m_hysteresis{ 10.0f }; //!< Additional distance an entity has to move away before it is removed from the scene.
+    };
+
+    //! Structure used to describe the selection of model LODs based on the distance to lidars.
+    struct LodSelectionConfiguration
+    {
+        AZ_TYPE_INFO(LodSelectionConfiguration, "{a1d3c6e2-7b4f-4e0a-9c85-5f2d8b1e7c93}");
+        static void Reflect(AZ::ReflectContext* context);
+
+        bool m_isEnabled{ false };
+        float m_trianglesPerHit{ 2.0f }; //!< Minimal number of triangles per expected lidar hit the selected LOD has to provide.
+        float m_hysteresis{ 0.25f }; //!< Fraction of the distance an entity has to move away before a coarser LOD is selected.
+    };
+
+    //! Structure used to describe the merging of static entities into batched RGL meshes.
+    struct StaticBatchingConfiguration
+    {
+        AZ_TYPE_INFO(StaticBatchingConfiguration, "{5c8e2a71-94d3-4b6f-b02e-7f1a3d9c6e58}");
+        static void Reflect(AZ::ReflectContext* context);
+
+        bool m_isEnabled{ false };
+        float m_staticTime{ 5.0f }; //!< Time (in seconds) an entity has to remain unchanged before it is batched.
+        float m_regionSize{ 64.0f }; //!< Size (in meters) of the square regions entities are grouped into.
+        //! Time (in seconds) a batched entity may remain non-resident before it is split out of its batches.
+        float m_nonResidentTime{ 2.0f };
+        AZ::u32 m_maxRebuildsPerTick{ 4U }; //!< Maximal number of batches rebuilt in a single tick (0 for no limit).
+    };
+
+    //! Structure used to describe the creation of intensity textures from material images.
+    struct MaterialTextureConfiguration
+    {
+        AZ_TYPE_INFO(MaterialTextureConfiguration, "{8d2b6f14-3a7e-4c91-b5d0-61e9f2a4c7b3}");
+        static void Reflect(AZ::ReflectContext* context);
+
+        //! Maximal number of texels of a single intensity texture (0 for no limit).
+        //! Lower resolution mips are used for images exceeding it.
+        AZ::u32 m_maxTexelCount{ 1024U * 1024U };
+        //! Textures with all texel values within this tolerance are collapsed into a single texel.
+        AZ::u8 m_uniformityTolerance{ 2U };
+    };
+
+    //! Structure used to describe how often skinned meshes are updated based on the distance to lidars.
+    struct AnimationLodConfiguration
+    {
+        AZ_TYPE_INFO(AnimationLodConfiguration, "{2f7c9b43-e1d6-4a58-93b0-c4e8a61d5f27}");
+        static void Reflect(AZ::ReflectContext* context);
+
+        bool m_isEnabled{ false };
+        AZ::u32 m_updateRateDivisor{ 1U }; //!< Skinned meshes are updated once every this many scene updates.
+        float m_freezeDistance{ 50.0f }; //!< Distance to the nearest lidar beyond which the pose of skinned meshes is frozen.
     };
 
     //! Structure used to describe all global scene parameters.
@@ -37,6 +123,15 @@ namespace RGL
         static void Reflect(AZ::ReflectContext* context);
 
         TerrainIntensityConfiguration m_terrainIntensityConfig;
+        TerrainMeshConfiguration m_terrainMeshConfig;
+        GeometryStreamingConfiguration m_geometryStreamingConfig;
+        LodSelectionConfiguration m_lodSelectionConfig;
+        StaticBatchingConfiguration m_staticBatchingConfig;
+        MaterialTextureConfiguration m_materialTextureConfig;
+        AnimationLodConfiguration m_animationLodConfig;
+        //! If set to true, entities with physics colliders are represented by the collider geometry instead of the render mesh.
+        //! Can be overridden per entity using the RaycastGeometryComponent.
+        bool m_isColliderGeometryEnabled{ false };
         // clang-format off
         bool m_isSkinnedMeshUpdateEnabled{ true }; //!< If set to true, all skinned meshes will be updated. Otherwise they will remain unchanged.
         // clang-format on
@@ -15,12 +15,20 @@
 
 #include <Entity/ActorEntityManager.h>
 
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/map.h>
+#include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/string/string.h>
 #include <EMotionFX/Source/Actor.h>
 #include <EMotionFX/Source/ActorInstance.h>
 #include <EMotionFX/Source/Mesh.h>
+#include <EMotionFX/Source/MeshDeformerStack.h>
 #include <EMotionFX/Source/Node.h>
+#include <EMotionFX/Source/Pose.h>
+#include <EMotionFX/Source/SkinningInfoVertexAttributeLayer.h>
+#include <EMotionFX/Source/SoftSkinDeformer.h>
 #include <EMotionFX/Source/SubMesh.h>
+#include <EMotionFX/Source/Transform.h>
 #include <EMotionFX/Source/TransformData.h>
 #include <RGL/RGLBus.h>
 #include <Utilities/RGLUtils.h>
@@ -30,8 +38,10 @@
 
 namespace RGL
 {
-    ActorEntityManager::ActorEntityManager(AZ::EntityId entityId)
+    ActorEntityManager::ActorEntityManager(AZ::EntityId entityId, bool areJointsRigid)
         : MaterialEntityManager(entityId)
+        , m_areJointsRigid{ areJointsRigid }
+        , m_sceneUpdateCount{ static_cast<AZ::u32>(static_cast<AZ::u64>(entityId)) }
     {
         AZ::EntityBus::Handler::BusConnect(m_entityId);
         EMotionFX::Integration::ActorComponentNotificationBus::Handler::BusConnect(entityId);
@@ -44,38 +54,92 @@ namespace RGL
         AZ::EntityBus::Handler::BusDisconnect();
     }
 
+    bool ActorEntityManager::PrepareParallelUpdate()
+    {
+        m_areStagingVerticesUpdated = false;
+        // Rigid parts are not deformed, only their poses are updated.
+        if (AreMeshesRigid())
+        {
+            return false;
+        }
+
+        // After the LOD change, the meshes have to be recreated in Update before they can be deformed.
+        if (m_entities.empty() || !m_emotionFxMesh || !m_actorInstance || m_actorInstance->GetLODLevel() != m_lodLevel)
+        {
+            return false;
+        }
+
+        return IsMeshVertexUpdateNeeded(RGLInterface::Get()->GetSceneConfiguration());
+    }
+
+    void ActorEntityManager::UpdateInParallel()
+    {
+        m_stagingVertices = Utils::RglBufferPool<rgl_vec3f>::Get().Acquire();
+        if (m_isInstanceSkinned)
+        {
+            SkinVertexPositions(*m_emotionFxMesh, *m_stagingVertices);
+        }
+        else
+        {
+            // The deformed positions are written into the mesh of the actor, shared by all of its instances.
+            // They have to be collected before another instance of the actor is deformed.
+            m_actorInstance->UpdateMeshDeformers(0.0f);
+            CollectVertexPositions(*m_emotionFxMesh, *m_stagingVertices);
+        }
+        m_areStagingVerticesUpdated = true;
+    }
+
+    const void* ActorEntityManager::GetParallelUpdateGroup() const
+    {
+        // Instances skinned from the bind pose only read the shared mesh, so they are updated independently.
+        return m_actorInstance && !m_isInstanceSkinned ? m_actorInstance->GetActor() : nullptr;
+    }
+
     void ActorEntityManager::Update()
     {
-        if (!m_entities.empty() && RGLInterface::Get()->GetSceneConfiguration().m_isSkinnedMeshUpdateEnabled)
+        if (m_actorInstance && m_actorInstance->GetLODLevel() != m_lodLevel)
+        {
+            ProcessActorLod(m_actorInstance->GetLODLevel());
+        }
+
+        if (m_areStagingVerticesUpdated && !m_entities.empty())
+        {
+            UploadMeshVertices();
+        }
+        else if (!m_entities.empty() && AreMeshesRigid())
         {
-            UpdateMeshVertices();
+            // Rigid parts follow the joints only when the skinned mesh would be deformed.
+            m_isPoseUpdateNeeded |= IsMeshVertexUpdateNeeded(RGLInterface::Get()->GetSceneConfiguration());
         }
         EntityManager::Update();
     }
 
-    void ActorEntityManager::OnActorInstanceCreated(EMotionFX::ActorInstance* actorInstance)
+    void ActorEntityManager::CollectMemoryUsage(MemoryUsageReport& report) const
     {
-        m_actorInstance = actorInstance;
-        EMotionFX::Actor* actor = actorInstance->GetActor();
-        [[maybe_unused]] const AZ::Entity* actorEntity = actorInstance->GetEntity();
-
-        static constexpr size_t LodLevel = 0U; // Highest LOD.
-        static constexpr size_t NodeIdx = 0U; // Default mesh node.
-        EMotionFX::Mesh* mesh = actor->GetMesh(LodLevel, NodeIdx);
-        if (!mesh)
+        // Shared meshes are reported by the ModelLibrary.
+        if (m_privateMeshes.empty())
         {
-            AZ_Assert(false, "No mesh found at joint 0. Unable to process the actor instance.");
             return;
         }
 
-        if (ProcessEfxMesh(*mesh))
+        MemoryUsage& entityUsage = report.m_entities[m_entityId];
+        for (const Wrappers::RglMesh& subMesh : m_privateMeshes)
         {
-            m_emotionFxMesh = mesh;
-            UpdateMaterialSlots(*actor);
-            m_isPoseUpdateNeeded = true;
+            entityUsage += subMesh.GetMemoryUsage();
         }
     }
 
+    void ActorEntityManager::SetAnimationLodOverride(const AZStd::optional<AnimationLodConfiguration>& animationLodOverride)
+    {
+        m_animationLodOverride = animationLodOverride;
+    }
+
+    void ActorEntityManager::OnActorInstanceCreated(EMotionFX::ActorInstance* actorInstance)
+    {
+        m_actorInstance = actorInstance;
+        ProcessActorLod(actorInstance->GetLODLevel());
+    }
+
     void ActorEntityManager::OnActorInstanceDestroyed([[maybe_unused]] EMotionFX::ActorInstance* actorInstance)
     {
         AZ::Render::MaterialComponentNotificationBus::Handler::BusDisconnect();
@@ -90,6 +154,46 @@ namespace RGL
         MaterialEntityManager::OnEntityDeactivated(entityId);
     }
 
+    void ActorEntityManager::UpdatePose()
+    {
+        if (!AreMeshesRigid() || !m_actorInstance)
+        {
+            EntityManager::UpdatePose();
+            return;
+        }
+
+        if (m_entities.empty())
+        {
+            m_isPoseUpdateNeeded = false;
+            return;
+        }
+
+        // Each rigid part is transformed from the bind pose to the current pose of its joint.
+        const AZ::Matrix3x4 entityPose = CalculateRglEntityPose();
+        const EMotionFX::Actor* actor = m_actorInstance->GetActor();
+        const EMotionFX::Pose* pose = m_actorInstance->GetTransformData()->GetCurrentPose();
+        for (size_t entityIdx = 0U; entityIdx < m_entities.size(); ++entityIdx)
+        {
+            if (!m_entities[entityIdx].IsValid())
+            {
+                continue;
+            }
+
+            const size_t jointIdx = m_sharedMeshes->m_jointIndices[entityIdx];
+            const AZ::Matrix3x4 jointPose = Matrix3x4FromEmfxTransform(pose->GetModelSpaceTransform(jointIdx)) *
+                Matrix3x4FromEmfxTransform(actor->GetInverseBindPoseTransform(jointIdx));
+            m_entities[entityIdx].SetTransform(Utils::RglMat3x4FromAzMatrix3x4(entityPose * jointPose));
+        }
+
+        m_isPoseUpdateNeeded = false;
+    }
+
+    void ActorEntityManager::OnRglEntitiesRecreated()
+    {
+        // Entities recreated from the shared meshes are in the bind pose, which is kept in m_uploadedVertices until the first deformation.
+        m_areUploadedVerticesValid = m_privateMeshes.empty();
+    }
+
     AZStd::vector<rgl_vec3i> ActorEntityManager::CollectIndexData(const EMotionFX::Mesh& mesh)
     {
         const size_t indexCount = mesh.GetNumIndices();
@@ -123,15 +227,68 @@ namespace RGL
         return rglIndices;
     }
 
-    AZStd::vector<rgl_vec3f> ActorEntityManager::GetMeshVertexPositions(const EMotionFX::Mesh& mesh)
+    void ActorEntityManager::CollectVertexPositions(const EMotionFX::Mesh& mesh, AZStd::vector<rgl_vec3f>& positions, bool isBindPose)
     {
         const size_t vertexCount = mesh.GetNumVertices();
-        const auto* vertices = static_cast<const AZ::Vector3*>(mesh.FindVertexData(EMotionFX::Mesh::ATTRIB_POSITIONS));
-        const auto vertexSpan = AZStd::span(vertices, vertexCount);
+        const void* vertexData = isBindPose ? mesh.FindOriginalVertexData(EMotionFX::Mesh::ATTRIB_POSITIONS) : nullptr;
+        if (!vertexData)
+        {
+            vertexData = mesh.FindVertexData(EMotionFX::Mesh::ATTRIB_POSITIONS);
+        }
+
+        const auto* vertices = static_cast<const AZ::Vector3*>(vertexData);
+        positions.resize_no_construct(vertexCount);
+        Utils::RglVec3fsFromAzVector3s(AZStd::span(vertices, vertexCount), positions.data());
+    }
+
+    bool ActorEntityManager::IsSkinnedByInstance(
+        const EMotionFX::Actor& actor, const EMotionFX::Mesh& mesh, size_t lodLevel, size_t nodeIdx)
+    {
+        // Other deformers (e.g. morph targets or dual quaternion skinning) are applied by EMotionFX to the shared mesh.
+        const EMotionFX::MeshDeformerStack* deformerStack = actor.GetMeshDeformerStack(lodLevel, nodeIdx);
+        if (!deformerStack || deformerStack->GetNumDeformers() != 1U ||
+            deformerStack->GetDeformer(0U)->GetType() != EMotionFX::SoftSkinDeformer::TYPE_ID)
+        {
+            return false;
+        }
 
-        AZStd::vector<rgl_vec3f> rglVertices(vertexCount);
-        AZStd::transform(vertexSpan.begin(), vertexSpan.end(), rglVertices.begin(), Utils::RglVector3FromAzVec3f);
-        return rglVertices;
+        return mesh.FindSharedVertexAttributeLayer(EMotionFX::SkinningInfoVertexAttributeLayer::TYPE_ID) &&
+            mesh.FindVertexData(EMotionFX::Mesh::ATTRIB_ORGVTXNUMBERS) && mesh.FindOriginalVertexData(EMotionFX::Mesh::ATTRIB_POSITIONS);
+    }
+
+    void ActorEntityManager::SkinVertexPositions(const EMotionFX::Mesh& mesh, AZStd::vector<rgl_vec3f>& positions)
+    {
+        // Skinning matrices transform the bind pose into the current pose of each joint, as in the soft skin deformer.
+        const EMotionFX::Actor* actor = m_actorInstance->GetActor();
+        const EMotionFX::Pose* pose = m_actorInstance->GetTransformData()->GetCurrentPose();
+        const size_t jointCount = actor->GetNumNodes();
+        m_skinningMatrices.resize_no_construct(jointCount);
+        for (size_t jointIdx = 0U; jointIdx < jointCount; ++jointIdx)
+        {
+            m_skinningMatrices[jointIdx] = Matrix3x4FromEmfxTransform(pose->GetModelSpaceTransform(jointIdx)) *
+                Matrix3x4FromEmfxTransform(actor->GetInverseBindPoseTransform(jointIdx));
+        }
+
+        auto* skinningLayer = static_cast<EMotionFX::SkinningInfoVertexAttributeLayer*>(
+            mesh.FindSharedVertexAttributeLayer(EMotionFX::SkinningInfoVertexAttributeLayer::TYPE_ID));
+        const auto* orgVertexNumbers = static_cast<const uint32*>(mesh.FindVertexData(EMotionFX::Mesh::ATTRIB_ORGVTXNUMBERS));
+        const auto* bindPositions = static_cast<const AZ::Vector3*>(mesh.FindOriginalVertexData(EMotionFX::Mesh::ATTRIB_POSITIONS));
+        const size_t vertexCount = mesh.GetNumVertices();
+        positions.resize_no_construct(vertexCount);
+        for (size_t vertexIdx = 0U; vertexIdx < vertexCount; ++vertexIdx)
+        {
+            // Vertices without influences stay in the bind pose.
+            const uint32 orgVertexIdx = orgVertexNumbers[vertexIdx];
+            const size_t influenceCount = skinningLayer->GetNumInfluences(orgVertexIdx);
+            AZ::Vector3 position = influenceCount > 0U ? AZ::Vector3::CreateZero() : bindPositions[vertexIdx];
+            for (size_t influenceIdx = 0U; influenceIdx < influenceCount; ++influenceIdx)
+            {
+                const EMotionFX::SkinInfluence* influence = skinningLayer->GetInfluence(orgVertexIdx, influenceIdx);
+                const AZ::Matrix3x4& skinningMatrix = m_skinningMatrices[influence->GetNodeNr()];
+                position += skinningMatrix.TransformPoint(bindPositions[vertexIdx]) * influence->GetWeight();
+            }
+            positions[vertexIdx] = Utils::RglVector3FromAzVec3f(position);
+        }
     }
 
     AZStd::optional<AZStd::vector<rgl_vec2f>> ActorEntityManager::CollectUvData(const EMotionFX::Mesh& mesh) const
@@ -153,35 +310,107 @@ namespace RGL
         return rglUvs;
     }
 
+    AZ::Matrix3x4 ActorEntityManager::Matrix3x4FromEmfxTransform(const EMotionFX::Transform& transform)
+    {
+        AZ::Matrix3x4 matrix = AZ::Matrix3x4::CreateFromQuaternionAndTranslation(transform.m_rotation, transform.m_position);
+#if !defined(EMFX_SCALE_DISABLED)
+        matrix *= AZ::Matrix3x4::CreateScale(transform.m_scale);
+#endif
+        return matrix;
+    }
+
+    void ActorEntityManager::ProcessActorLod(size_t lodLevel)
+    {
+        ResetMaterialsMapping();
+        ClearRglEntities();
+        m_privateMeshes.clear();
+        m_sharedMeshes = nullptr;
+        m_emotionFxMesh = nullptr;
+        m_isInstanceSkinned = false;
+        m_lodLevel = lodLevel;
+
+        EMotionFX::Actor* actor = m_actorInstance->GetActor();
+        static constexpr size_t NodeIdx = 0U; // Default mesh node.
+        EMotionFX::Mesh* mesh = actor->GetMesh(lodLevel, NodeIdx);
+        if (!mesh)
+        {
+            AZ_Assert(false, "No mesh found at joint 0. Unable to process the actor instance.");
+            return;
+        }
+
+        if (ProcessEfxMesh(*actor, *mesh))
+        {
+            m_emotionFxMesh = mesh;
+            m_isInstanceSkinned = IsSkinnedByInstance(*actor, *mesh, lodLevel, NodeIdx);
+            UpdateMaterialSlots(*actor);
+            m_isPoseUpdateNeeded = true;
+        }
+    }
+
     void ActorEntityManager::UpdateMaterialSlots(const EMotionFX::Actor& actor)
     {
         const AZ::Data::Asset<AZ::RPI::ModelAsset>& modelAsset = actor.GetMeshAsset();
         const auto lodAssets = modelAsset->GetLodAssets();
-        // Get Highest LOD
-        const auto modelLodAsset = lodAssets.begin()->Get();
+        const auto modelLodAsset = lodAssets[AZStd::min(m_lodLevel, lodAssets.size() - 1U)].Get();
         const auto meshes = modelLodAsset->GetMeshes();
 
-        // Each mesh of the model is associated with one EFX sub mesh.
-        for (size_t subMeshIdx = 0; subMeshIdx < meshes.size(); ++subMeshIdx)
+        // Each mesh of the model is associated with one EFX sub mesh, which may be split into multiple RGL entities.
+        for (size_t entityIdx = 0; entityIdx < m_sharedMeshes->m_subMeshIndices.size(); ++entityIdx)
         {
+            const size_t subMeshIdx = m_sharedMeshes->m_subMeshIndices[entityIdx];
+            if (subMeshIdx >= meshes.size())
+            {
+                continue;
+            }
+
             const AZ::RPI::ModelMaterialSlot& slot = modelAsset->FindMaterialSlot(meshes[subMeshIdx].GetMaterialSlotId());
-            AssignMaterialSlotIdForMesh(slot.m_stableId, subMeshIdx);
+            AssignMaterialSlotIdForMesh(slot.m_stableId, entityIdx);
+
+            // Materials assigned before the LOD change have to be reapplied.
+            if (const Wrappers::RglTexture* texture = GetMaterialSlotOverride(slot.m_stableId);
+                texture && entityIdx < m_entityDescriptions.size())
+            {
+                SetIntensityTexture(entityIdx, *texture);
+            }
         }
 
         // We can use material info only when the model is ready.
         AZ::Render::MaterialComponentNotificationBus::Handler::BusConnect(m_entityId);
     }
 
-    void ActorEntityManager::UpdateMeshVertices()
+    bool ActorEntityManager::IsMeshVertexUpdateNeeded(const SceneConfiguration& sceneConfig)
     {
-        if (!m_emotionFxMesh || !m_actorInstance)
+        if (!sceneConfig.m_isSkinnedMeshUpdateEnabled)
         {
-            return;
+            return false;
+        }
+
+        const AnimationLodConfiguration& animationLodConfig = sceneConfig.m_animationLodConfig;
+        if (!animationLodConfig.m_isEnabled)
+        {
+            return true;
         }
 
-        m_actorInstance->UpdateMeshDeformers(0.0f);
+        // The override replaces the parameters only, the animation LOD is enabled globally.
+        const AnimationLodConfiguration& config = m_animationLodOverride.has_value() ? m_animationLodOverride.value() : animationLodConfig;
+        if (!IsWithinLidarRange() || GetLidarObservationDistance() > config.m_freezeDistance)
+        {
+            return false;
+        }
+
+        ++m_sceneUpdateCount;
+        return m_sceneUpdateCount % AZStd::max(config.m_updateRateDivisor, 1U) == 0U;
+    }
+
+    bool ActorEntityManager::AreMeshesRigid() const
+    {
+        return m_sharedMeshes && !m_sharedMeshes->m_jointIndices.empty();
+    }
 
-        const auto vertexPositions = GetMeshVertexPositions(*m_emotionFxMesh);
+    void ActorEntityManager::UploadMeshVertices()
+    {
+        const bool areUploadedVerticesValid =
+            m_areUploadedVerticesValid && m_uploadedVertices && m_uploadedVertices->size() == m_stagingVertices->size();
         const size_t subMeshCount = m_emotionFxMesh->GetNumSubMeshes();
         for (size_t subMeshNr = 0; subMeshNr < subMeshCount; ++subMeshNr)
         {
@@ -189,14 +418,117 @@ namespace RGL
             const size_t vertexBase = subMesh->GetStartVertex();
             const size_t subMeshVertexCount = subMesh->GetNumVertices();
 
-            m_entities[subMeshNr].ApplyExternalAnimation(vertexPositions.data() + vertexBase, subMeshVertexCount);
+            // Sub meshes which are not deformed (e.g. in the idle pose) are not uploaded again.
+            // The uploaded vertices may still be read by the RGL commands, which is safe since neither side modifies them.
+            if (areUploadedVerticesValid &&
+                memcmp(
+                    m_stagingVertices->data() + vertexBase,
+                    m_uploadedVertices->data() + vertexBase,
+                    subMeshVertexCount * sizeof(rgl_vec3f)) == 0)
+            {
+                continue;
+            }
+
+            // The shared meshes must not be deformed, so the instance switches to its own meshes, created already deformed.
+            if (m_privateMeshes.empty())
+            {
+                if (!CreatePrivateMeshes())
+                {
+                    m_areStagingVerticesUpdated = false;
+                    return;
+                }
+                break;
+            }
+
+            if (m_entities[subMeshNr].IsValid())
+            {
+                m_entities[subMeshNr].ApplyExternalAnimation(m_stagingVertices, vertexBase, subMeshVertexCount);
+            }
         }
+
+        // The previously uploaded buffer returns to the pool once the commands reading it are executed.
+        m_uploadedVertices = AZStd::move(m_stagingVertices);
+        m_areUploadedVerticesValid = true;
+        m_areStagingVerticesUpdated = false;
     }
 
-    bool ActorEntityManager::ProcessEfxMesh(const EMotionFX::Mesh& mesh)
+    bool ActorEntityManager::ProcessEfxMesh(const EMotionFX::Actor& actor, const EMotionFX::Mesh& mesh)
     {
-        const auto vertexPositions = GetMeshVertexPositions(mesh);
+        // New RGL entities use the bind pose of the shared meshes until the first deformation is applied.
+        m_uploadedVertices = Utils::RglBufferPool<rgl_vec3f>::Get().Acquire();
+        CollectVertexPositions(mesh, *m_uploadedVertices, true);
+        m_areUploadedVerticesValid = true;
+        m_areStagingVerticesUpdated = false;
+
+        // All instances of the actor share the meshes of each LOD. The model asset identifies the actor.
+        ModelLibraryRequests* modelLibrary = ModelLibraryInterface::Get();
+        const AZ::Data::AssetId& actorAssetId = actor.GetMeshAsset().GetId();
+        m_sharedMeshes = modelLibrary->FindActorMeshes(actorAssetId, m_lodLevel, m_areJointsRigid);
+        if (!m_sharedMeshes)
+        {
+            ActorMeshList meshes;
+            const bool areMeshesCreated = m_areJointsRigid ? CreateRigidMeshes(mesh, *m_uploadedVertices, meshes)
+                                                           : CreateSkinnedMeshes(mesh, *m_uploadedVertices, meshes);
+            if (!areMeshesCreated)
+            {
+                AZ_Error(
+                    "RGL",
+                    false,
+                    "[Entity: %s] Rgl mesh creation failed for one of the sub meshes of an entity with an actor component. Some geometry "
+                    "will not be present.",
+                    m_entityId.ToString().c_str());
+                return false;
+            }
+
+            m_sharedMeshes = &modelLibrary->StoreActorMeshes(actorAssetId, m_lodLevel, m_areJointsRigid, AZStd::move(meshes));
+        }
+
+        m_entityDescriptions.reserve(m_sharedMeshes->m_meshes.size());
+        for (const Wrappers::RglMesh& subMesh : m_sharedMeshes->m_meshes)
+        {
+            if (!AddRglEntity(subMesh, nullptr))
+            {
+                ClearRglEntities();
+                m_sharedMeshes = nullptr;
+                AZ_Error(
+                    "RGL",
+                    false,
+                    "[Entity: %s] Rgl entity creation failed for one of the sub meshes of an entity with an actor component. Some geometry "
+                    "will not be present.",
+                    m_entityId.ToString().c_str());
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    bool ActorEntityManager::CreatePrivateMeshes()
+    {
+        ActorMeshList meshes;
+        if (!CreateSkinnedMeshes(*m_emotionFxMesh, *m_stagingVertices, meshes))
+        {
+            AZ_Error(
+                "RGL",
+                false,
+                "[Entity: %s] Rgl mesh creation failed for one of the sub meshes of an entity with an actor component. The mesh will "
+                "not be deformed.",
+                m_entityId.ToString().c_str());
+            return false;
+        }
+
+        m_privateMeshes = AZStd::move(meshes.m_meshes);
+        for (size_t entityIdx = 0U; entityIdx < m_privateMeshes.size(); ++entityIdx)
+        {
+            SetRglEntityMesh(entityIdx, m_privateMeshes[entityIdx]);
+        }
 
+        return true;
+    }
+
+    bool ActorEntityManager::CreateSkinnedMeshes(
+        const EMotionFX::Mesh& mesh, const AZStd::vector<rgl_vec3f>& vertexPositions, ActorMeshList& meshes) const
+    {
         const size_t subMeshCount = mesh.GetNumSubMeshes();
         const auto indices = CollectIndexData(mesh);
         const auto uvData = CollectUvData(mesh);
@@ -210,52 +542,125 @@ namespace RGL
             const size_t indexCount = subMesh->GetNumIndices() / 3U;
 
             auto rglMesh = Wrappers::RglMesh(vertexPositions.data() + vertexBase, vertexCount, indices.data() + indexBase, indexCount);
-
-            if (rglMesh.IsValid())
+            if (!rglMesh.IsValid())
             {
-                if (uvData.has_value())
-                {
-                    rglMesh.SetTextureCoordinates(uvData->data() + vertexBase, vertexCount);
-                }
-
-                m_rglSubMeshes.push_back(AZStd::move(rglMesh));
+                return false;
             }
-            else
+
+            if (uvData.has_value())
             {
-                m_rglSubMeshes.clear();
-                AZ_Error(
-                    "RGL",
-                    false,
-                    "[Entity: %s] Rgl mesh creation failed for one of the sub meshes of an entity with an actor component. Some geometry "
-                    "will not be present.",
-                    m_entityId.ToString().c_str());
-                return false;
+                rglMesh.SetTextureCoordinates(uvData->data() + vertexBase, vertexCount);
             }
+
+            meshes.m_meshes.push_back(AZStd::move(rglMesh));
+            meshes.m_subMeshIndices.push_back(subMeshNr);
         }
 
-        m_entities.reserve(m_rglSubMeshes.size());
-        for (size_t i = 0; i < m_rglSubMeshes.size(); ++i)
+        return true;
+    }
+
+    bool ActorEntityManager::CreateRigidMeshes(
+        const EMotionFX::Mesh& mesh, const AZStd::vector<rgl_vec3f>& bindVertexPositions, ActorMeshList& meshes) const
+    {
+        auto* skinningLayer = static_cast<EMotionFX::SkinningInfoVertexAttributeLayer*>(
+            mesh.FindSharedVertexAttributeLayer(EMotionFX::SkinningInfoVertexAttributeLayer::TYPE_ID));
+        const auto* orgVertexNumbers = static_cast<const uint32*>(mesh.FindVertexData(EMotionFX::Mesh::ATTRIB_ORGVTXNUMBERS));
+        if (!skinningLayer || !orgVertexNumbers)
+        {
+            AZ_Warning(
+                "RGL",
+                false,
+                "[Entity: %s] The actor mesh provides no skinning data. It is deformed instead of being split into rigid parts.",
+                m_entityId.ToString().c_str());
+            return CreateSkinnedMeshes(mesh, bindVertexPositions, meshes);
+        }
+
+        // Each vertex follows the joint with the highest skin weight. Vertices without influences follow the mesh joint.
+        const size_t vertexCount = mesh.GetNumVertices();
+        AZStd::vector<size_t> vertexJoints(vertexCount, 0U);
+        for (size_t vertexIdx = 0U; vertexIdx < vertexCount; ++vertexIdx)
         {
-            if (Wrappers::RglEntity subMeshEntity(m_rglSubMeshes[i]); subMeshEntity.IsValid())
+            const uint32 orgVertexIdx = orgVertexNumbers[vertexIdx];
+            float maxWeight = 0.0f;
+            for (size_t influenceIdx = 0U; influenceIdx < skinningLayer->GetNumInfluences(orgVertexIdx); ++influenceIdx)
             {
-                if (m_packedRglEntityId.has_value())
+                const EMotionFX::SkinInfluence* influence = skinningLayer->GetInfluence(orgVertexIdx, influenceIdx);
+                if (influence->GetWeight() > maxWeight)
                 {
-                    subMeshEntity.SetId(m_packedRglEntityId.value());
+                    maxWeight = influence->GetWeight();
+                    vertexJoints[vertexIdx] = influence->GetNodeNr();
                 }
+            }
+        }
+
+        // Geometry of a rigid part, with vertices copied from the sub mesh.
+        struct RigidPart
+        {
+            AZStd::vector<rgl_vec3f> m_vertices;
+            AZStd::vector<rgl_vec2f> m_uvs;
+            AZStd::vector<rgl_vec3i> m_indices;
+            AZStd::unordered_map<size_t, int32_t> m_vertexIndexMap; //!< Maps mesh vertex indices to part vertex indices.
+        };
+
+        const uint32* indices = mesh.GetIndices();
+        const auto uvData = CollectUvData(mesh);
+        for (size_t subMeshNr = 0; subMeshNr < mesh.GetNumSubMeshes(); ++subMeshNr)
+        {
+            const EMotionFX::SubMesh* subMesh = mesh.GetSubMesh(subMeshNr);
+            const size_t vertexBase = subMesh->GetStartVertex();
+            const size_t indexBase = subMesh->GetStartIndex();
 
-                m_entities.emplace_back(AZStd::move(subMeshEntity));
+            // Parts are ordered by the joint index to keep the entity order deterministic.
+            AZStd::map<size_t, RigidPart> parts;
+            for (size_t triangleIndexIdx = 0U; triangleIndexIdx + 2U < subMesh->GetNumIndices(); triangleIndexIdx += 3U)
+            {
+                const AZStd::array<size_t, 3U> triangleVertices{
+                    vertexBase + indices[indexBase + triangleIndexIdx],
+                    vertexBase + indices[indexBase + triangleIndexIdx + 1U],
+                    vertexBase + indices[indexBase + triangleIndexIdx + 2U],
+                };
+
+                // The triangle follows the joint shared by most of its vertices (or the joint of its first vertex).
+                const size_t jointIdx = vertexJoints[triangleVertices[1]] == vertexJoints[triangleVertices[2]]
+                    ? vertexJoints[triangleVertices[1]]
+                    : vertexJoints[triangleVertices[0]];
+
+                RigidPart& part = parts[jointIdx];
+                rgl_vec3i& triangle = part.m_indices.emplace_back();
+                for (size_t corner = 0U; corner < triangleVertices.size(); ++corner)
+                {
+                    const size_t vertexIdx = triangleVertices[corner];
+                    auto [it, inserted] = part.m_vertexIndexMap.emplace(vertexIdx, aznumeric_cast<int32_t>(part.m_vertices.size()));
+                    if (inserted)
+                    {
+                        part.m_vertices.push_back(bindVertexPositions[vertexIdx]);
+                        if (uvData.has_value())
+                        {
+                            part.m_uvs.push_back((*uvData)[vertexIdx]);
+                        }
+                    }
+
+                    triangle.value[corner] = it->second;
+                }
             }
-            else
+
+            for (const auto& [jointIdx, part] : parts)
             {
-                m_rglSubMeshes.clear();
-                m_entities.clear();
-                AZ_Error(
-                    "RGL",
-                    false,
-                    "[Entity: %s] Rgl entity creation failed for one of the sub meshes of an entity with an actor component. Some geometry "
-                    "will not be present.",
-                    m_entityId.ToString().c_str());
-                return false;
+                auto rglMesh =
+                    Wrappers::RglMesh(part.m_vertices.data(), part.m_vertices.size(), part.m_indices.data(), part.m_indices.size());
+                if (!rglMesh.IsValid())
+                {
+                    return false;
+                }
+
+                if (!part.m_uvs.empty())
+                {
+                    rglMesh.SetTextureCoordinates(part.m_uvs.data(), part.m_uvs.size());
+                }
+
+                meshes.m_meshes.push_back(AZStd::move(rglMesh));
+                meshes.m_subMeshIndices.push_back(subMeshNr);
+                meshes.m_jointIndices.push_back(jointIdx);
             }
         }
 
@@ -265,9 +670,17 @@ namespace RGL
     void ActorEntityManager::ClearActorData()
     {
         ResetMaterialsMapping();
-        m_entities.clear();
-        m_rglSubMeshes.clear();
+        ResetMaterialSlotOverrides();
+        ClearRglEntities();
+        m_privateMeshes.clear();
+        m_sharedMeshes = nullptr;
+        m_stagingVertices.Reset();
+        m_uploadedVertices.Reset();
+        m_areUploadedVerticesValid = false;
+        m_areStagingVerticesUpdated = false;
         m_emotionFxMesh = nullptr;
+        m_isInstanceSkinned = false;
         m_actorInstance = nullptr;
+        m_lodLevel = 0U;
     }
 } // namespace RGL
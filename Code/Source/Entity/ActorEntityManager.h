@@ -15,16 +15,21 @@
 #pragma once
 
 #include <AtomLyIntegration/CommonFeatures/Material/MaterialComponentBus.h>
+#include <AzCore/Math/Matrix3x4.h>
 #include <AzCore/std/containers/vector.h>
 #include <Entity/MaterialEntityManager.h>
 #include <Integration/ActorComponentBus.h>
+#include <RGL/SceneConfiguration.h>
+#include <Utilities/RglBufferPool.h>
 #include <Wrappers/RglMesh.h>
 #include <rgl/api/core.h>
 
 namespace EMotionFX
 {
+    class Actor;
     class Mesh;
     class ActorInstance;
+    class Transform;
 } // namespace EMotionFX
 
 namespace RGL
@@ -34,14 +39,25 @@ namespace RGL
         , public EMotionFX::Integration::ActorComponentNotificationBus::Handler
     {
     public:
-        explicit ActorEntityManager(AZ::EntityId entityId);
+        //! @param areJointsRigid If true, the mesh is split into rigid parts following single joints instead of being deformed.
+        ActorEntityManager(AZ::EntityId entityId, bool areJointsRigid);
         ActorEntityManager(const ActorEntityManager& other) = delete;
         ActorEntityManager(ActorEntityManager&& other) = delete;
         ActorEntityManager& operator=(ActorEntityManager&& rhs) = delete;
         ActorEntityManager& operator=(const ActorEntityManager&) = delete;
         ~ActorEntityManager();
 
+        bool PrepareParallelUpdate() override;
+        //! Deforms the mesh and collects the vertex positions. The RGL entities are updated in Update.
+        void UpdateInParallel() override;
+        //! Returns the actor if its meshes (shared by all of its instances) are the destination of the mesh deformation.
+        //! Instances skinned from the bind pose (see SkinVertexPositions) return nullptr, since they modify no shared data.
+        [[nodiscard]] const void* GetParallelUpdateGroup() const override;
         void Update() override;
+        void CollectMemoryUsage(MemoryUsageReport& report) const override;
+
+        //! Sets the animation LOD parameters used instead of the ones from the scene configuration.
+        void SetAnimationLodOverride(const AZStd::optional<AnimationLodConfiguration>& animationLodOverride);
 
     protected:
         // ActorComponentNotificationBus overrides
@@ -51,21 +67,71 @@ namespace RGL
         // AZ::EntityBus::Handler implementation overrides
         void OnEntityDeactivated(const AZ::EntityId& entityId) override;
 
+        // EntityManager overrides
+        void UpdatePose() override;
+        void OnRglEntitiesRecreated() override;
+
     private:
         static AZStd::vector<rgl_vec3i> CollectIndexData(const EMotionFX::Mesh& mesh);
-        static AZStd::vector<rgl_vec3f> GetMeshVertexPositions(const EMotionFX::Mesh& mesh);
+        //! Converts the vertex positions of the mesh into RGL vectors, reusing the buffer's capacity.
+        //! @param isBindPose If true, the original (undeformed) positions are used, if available.
+        static void CollectVertexPositions(const EMotionFX::Mesh& mesh, AZStd::vector<rgl_vec3f>& positions, bool isBindPose = false);
+        //! Returns true if the mesh is deformed by linear skinning only and provides the data to skin it in SkinVertexPositions.
+        static bool IsSkinnedByInstance(const EMotionFX::Actor& actor, const EMotionFX::Mesh& mesh, size_t lodLevel, size_t nodeIdx);
+        //! Skins the bind pose vertex positions of the mesh using the current pose of the actor instance.
+        //! Unlike the EMotionFX deformers, it does not write into the mesh shared by all instances of the actor.
+        void SkinVertexPositions(const EMotionFX::Mesh& mesh, AZStd::vector<rgl_vec3f>& positions);
         AZStd::optional<AZStd::vector<rgl_vec2f>> CollectUvData(const EMotionFX::Mesh& mesh) const;
+        static AZ::Matrix3x4 Matrix3x4FromEmfxTransform(const EMotionFX::Transform& transform);
 
+        //! Creates RGL entities for the provided LOD of the actor. Any previously created entities are destroyed.
+        void ProcessActorLod(size_t lodLevel);
         void UpdateMaterialSlots(const EMotionFX::Actor& actor);
-        void UpdateMeshVertices();
-        //! Loads mesh's vertex position data into the m_tempVertexPositions buffer.
-        bool ProcessEfxMesh(const EMotionFX::Mesh& mesh);
+        //! Returns true if the skinned mesh should be updated in the current scene update.
+        [[nodiscard]] bool IsMeshVertexUpdateNeeded(const SceneConfiguration& sceneConfig);
+        //! Returns true if the RGL entities are rigid parts of the actor, following single joints.
+        [[nodiscard]] bool AreMeshesRigid() const;
+        //! Applies the vertex positions collected in UpdateInParallel to the RGL entities.
+        void UploadMeshVertices();
+        //! Creates RGL entities using the bind pose meshes of the actor LOD, shared with other instances of the actor.
+        bool ProcessEfxMesh(const EMotionFX::Actor& actor, const EMotionFX::Mesh& mesh);
+        //! Replaces the shared meshes of the RGL entities with meshes owned by this instance, using m_stagingVertices.
+        bool CreatePrivateMeshes();
+        //! Creates one RGL mesh per sub mesh of the EMotionFX mesh using the provided vertex positions.
+        bool CreateSkinnedMeshes(const EMotionFX::Mesh& mesh, const AZStd::vector<rgl_vec3f>& vertexPositions, ActorMeshList& meshes) const;
+        //! Splits each sub mesh into rigid parts, one per joint with the highest skin weight of the triangle vertices.
+        //! The parts use the bind pose vertex positions and are moved using the transforms of their joints.
+        bool CreateRigidMeshes(
+            const EMotionFX::Mesh& mesh, const AZStd::vector<rgl_vec3f>& bindVertexPositions, ActorMeshList& meshes) const;
         void ClearActorData();
 
         EMotionFX::ActorInstance* m_actorInstance = nullptr;
-        // We do not use the ModelLibrary since the actor mesh is
-        // skinned and the mesh sharing would not be useful.
         EMotionFX::Mesh* m_emotionFxMesh;
-        AZStd::vector<Wrappers::RglMesh> m_rglSubMeshes;
+        //! Bind pose meshes of the current LOD, shared with other instances of the actor through the ModelLibrary.
+        //! The RGL entities use them until the mesh is deformed for the first time.
+        const ActorMeshList* m_sharedMeshes{ nullptr };
+        //! Meshes owned by this instance, matching the shared meshes. Empty while the RGL entities use the shared meshes.
+        AZStd::vector<Wrappers::RglMesh> m_privateMeshes;
+        bool m_areJointsRigid{ false };
+        //! True if the mesh is skinned by this instance in SkinVertexPositions instead of being deformed by EMotionFX.
+        bool m_isInstanceSkinned{ false };
+        //! Skinning matrices of the actor joints. Kept between updates to avoid reallocation.
+        AZStd::vector<AZ::Matrix3x4> m_skinningMatrices;
+        //! Deformed vertex positions of the current update, collected into a pooled buffer to avoid reallocation.
+        //! The sub mesh updates share the buffer with the RGL commands instead of copying it.
+        Utils::RglBufferPool<rgl_vec3f>::BufferPtr m_stagingVertices;
+        //! Vertex positions applied to the RGL entities in the last update. Replaced by m_stagingVertices after each update.
+        Utils::RglBufferPool<rgl_vec3f>::BufferPtr m_uploadedVertices;
+        //! True if m_stagingVertices were collected in the current scene update.
+        bool m_areStagingVerticesUpdated{ false };
+        //! False if the RGL entities do not use m_uploadedVertices (e.g. they were recreated), so all sub meshes have to be updated.
+        bool m_areUploadedVerticesValid{ false };
+        //! LOD of the actor used to create the RGL meshes.
+        //! It follows the LOD of the actor instance, since only the current LOD is deformed by EMotionFX.
+        size_t m_lodLevel{ 0U };
+        AZStd::optional<AnimationLodConfiguration> m_animationLodOverride;
+        //! Number of scene updates, used to update the mesh once every few scene updates.
+        //! Initialized using the entity ID, so that the updates of different actors are spread over consecutive scene updates.
+        AZ::u32 m_sceneUpdateCount;
     };
 } // namespace RGL
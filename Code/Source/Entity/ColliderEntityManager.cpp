@@ -0,0 +1,215 @@
+/* Copyright 2024, Robotec.ai sp. z o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <AzFramework/Physics/HeightfieldProviderBus.h>
+#include <AzFramework/Physics/Shape.h>
+#include <Entity/ColliderEntityManager.h>
+#include <Model/ModelLibraryBus.h>
+#include <Utilities/RGLUtils.h>
+#include <Wrappers/RglTexture.h>
+
+namespace RGL
+{
+    ColliderEntityManager::ColliderEntityManager(AZ::EntityId entityId)
+        : EntityManager{ entityId }
+    {
+        // PhysX bakes the entity scale into the collider geometry.
+        m_isScaleAppliedToPose = false;
+        AZ::EntityBus::Handler::BusConnect(m_entityId);
+    }
+
+    ColliderEntityManager::~ColliderEntityManager()
+    {
+        AZ::Render::MaterialComponentNotificationBus::Handler::BusDisconnect();
+        AZ::Render::MeshComponentNotificationBus::Handler::BusDisconnect();
+        Physics::ColliderComponentEventBus::Handler::BusDisconnect();
+        AZ::EntityBus::Handler::BusDisconnect();
+    }
+
+    void ColliderEntityManager::CollectMemoryUsage(MemoryUsageReport& report) const
+    {
+        if (m_colliderMeshes.empty())
+        {
+            return;
+        }
+
+        MemoryUsage& entityUsage = report.m_entities[m_entityId];
+        for (const Wrappers::RglMesh& mesh : m_colliderMeshes)
+        {
+            entityUsage += mesh.GetMemoryUsage();
+        }
+    }
+
+    void ColliderEntityManager::OnEntityActivated(const AZ::EntityId& entityId)
+    {
+        EntityManager::OnEntityActivated(entityId);
+        ProcessColliderShapes();
+        Physics::ColliderComponentEventBus::Handler::BusConnect(entityId);
+        AZ::Render::MeshComponentNotificationBus::Handler::BusConnect(entityId);
+    }
+
+    void ColliderEntityManager::OnEntityDeactivated(const AZ::EntityId& entityId)
+    {
+        AZ::Render::MaterialComponentNotificationBus::Handler::BusDisconnect();
+        AZ::Render::MeshComponentNotificationBus::Handler::BusDisconnect();
+        Physics::ColliderComponentEventBus::Handler::BusDisconnect();
+        ClearColliderMeshes();
+        m_intensityMaterialSlotId = AZ::RPI::ModelMaterialSlot::InvalidStableId;
+        m_intensityTexture = nullptr;
+        EntityManager::OnEntityDeactivated(entityId);
+    }
+
+    void ColliderEntityManager::OnColliderChanged()
+    {
+        ClearColliderMeshes();
+        ProcessColliderShapes();
+    }
+
+    void ColliderEntityManager::OnModelReady(
+        const AZ::Data::Asset<AZ::RPI::ModelAsset>& modelAsset, [[maybe_unused]] const AZ::Data::Instance<AZ::RPI::Model>& model)
+    {
+        const auto lodAssets = modelAsset->GetLodAssets();
+        if (lodAssets.empty() || lodAssets.begin()->Get()->GetMeshes().empty())
+        {
+            return;
+        }
+
+        // Collider shapes cannot be matched with the render meshes, so the material of the first mesh is used for all of them.
+        const auto& firstMesh = lodAssets.begin()->Get()->GetMeshes().front();
+        const AZ::RPI::ModelMaterialSlot& slot = modelAsset->FindMaterialSlot(firstMesh.GetMaterialSlotId());
+        m_intensityMaterialSlotId = slot.m_stableId;
+        SetIntensityTextureForAllMeshes(StoreMaterialTexture(slot.m_defaultMaterialAsset));
+
+        // We can use material info only when the model is ready.
+        AZ::Render::MaterialComponentNotificationBus::Handler::BusConnect(m_entityId);
+    }
+
+    void ColliderEntityManager::OnModelPreDestroy()
+    {
+        AZ::Render::MaterialComponentNotificationBus::Handler::BusDisconnect();
+        m_intensityMaterialSlotId = AZ::RPI::ModelMaterialSlot::InvalidStableId;
+    }
+
+    void ColliderEntityManager::OnMaterialsUpdated(const AZ::Render::MaterialAssignmentMap& materials)
+    {
+        for (const auto& [assignmentId, assignment] : materials)
+        {
+            if (assignmentId.m_materialSlotStableId != m_intensityMaterialSlotId)
+            {
+                continue;
+            }
+
+            const Wrappers::RglTexture& materialTexture = StoreMaterialTexture(assignment.m_materialAsset);
+            if (materialTexture.IsValid())
+            {
+                SetIntensityTextureForAllMeshes(materialTexture);
+            }
+        }
+    }
+
+    void ColliderEntityManager::OnMaterialTextureReady(const Wrappers::RglTexture& placeholder, const Wrappers::RglTexture& texture)
+    {
+        if (m_intensityTexture == &placeholder)
+        {
+            m_intensityTexture = &texture;
+        }
+
+        EntityManager::OnMaterialTextureReady(placeholder, texture);
+    }
+
+    void ColliderEntityManager::ProcessColliderShapes()
+    {
+        // Heightfield colliders can only be attached to heightfield providers. Their shapes are handled by the terrain entity manager.
+        // Physics::Shape does not expose its geometry type and the shapes are not guaranteed to match the shape configurations
+        // one-to-one, so a heightfield provider entity is skipped as a whole.
+        if (Physics::HeightfieldProviderRequestsBus::HasHandlers(m_entityId))
+        {
+            return;
+        }
+
+        AZStd::vector<AZStd::shared_ptr<Physics::Shape>> shapes;
+        Physics::ColliderComponentRequestBus::EventResult(shapes, m_entityId, &Physics::ColliderComponentRequests::GetShapes);
+
+        AZStd::vector<AZ::Vector3> vertices;
+        AZStd::vector<AZ::u32> indices;
+        AZStd::vector<rgl_vec3f> rglVertices;
+        m_colliderMeshes.reserve(shapes.size());
+        for (const AZStd::shared_ptr<Physics::Shape>& shape : shapes)
+        {
+            if (!shape)
+            {
+                continue;
+            }
+
+            vertices.clear();
+            indices.clear();
+            shape->GetGeometry(vertices, indices);
+            if (vertices.empty() || indices.size() < 3U)
+            {
+                continue;
+            }
+
+            // The geometry is provided in the shape space.
+            const auto [localPosition, localRotation] = shape->GetLocalPose();
+            const AZ::Transform localPose = AZ::Transform::CreateFromQuaternionAndTranslation(localRotation, localPosition);
+            rglVertices.clear();
+            rglVertices.reserve(vertices.size());
+            for (const AZ::Vector3& vertex : vertices)
+            {
+                rglVertices.push_back(Utils::RglVector3FromAzVec3f(localPose.TransformPoint(vertex)));
+            }
+
+            static_assert(sizeof(rgl_vec3i) == 3U * sizeof(AZ::u32), "Index triples have to be tightly packed.");
+            Wrappers::RglMesh mesh(
+                rglVertices.data(), rglVertices.size(), reinterpret_cast<const rgl_vec3i*>(indices.data()), indices.size() / 3U);
+            if (mesh.IsValid())
+            {
+                m_colliderMeshes.push_back(AZStd::move(mesh));
+            }
+        }
+
+        // Meshes are added only after all of them are created, since the descriptions point into m_colliderMeshes.
+        m_entityDescriptions.reserve(m_colliderMeshes.size());
+        for (const Wrappers::RglMesh& mesh : m_colliderMeshes)
+        {
+            AddRglEntity(mesh, m_intensityTexture);
+        }
+
+        AZ_Warning(
+            __func__,
+            !m_colliderMeshes.empty(),
+            "Entity with ID: %s has no collider geometry yet. It will be added to the RGL scene once its colliders change.",
+            m_entityId.ToString().c_str());
+    }
+
+    void ColliderEntityManager::ClearColliderMeshes()
+    {
+        ClearRglEntities();
+        m_colliderMeshes.clear();
+    }
+
+    void ColliderEntityManager::SetIntensityTextureForAllMeshes(const Wrappers::RglTexture& texture)
+    {
+        if (!texture.IsValid())
+        {
+            return;
+        }
+
+        m_intensityTexture = &texture;
+        for (size_t entityIdx = 0U; entityIdx < m_entityDescriptions.size(); ++entityIdx)
+        {
+            SetIntensityTexture(entityIdx, texture);
+        }
+    }
+} // namespace RGL
@@ -0,0 +1,78 @@
+/* Copyright 2024, Robotec.ai sp. z o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <AtomLyIntegration/CommonFeatures/Material/MaterialComponentBus.h>
+#include <AtomLyIntegration/CommonFeatures/Mesh/MeshComponentBus.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzFramework/Physics/ColliderComponentBus.h>
+#include <Entity/EntityManager.h>
+#include <Wrappers/RglMesh.h>
+
+namespace RGL
+{
+    //! Class used for managing RGL's representation of an Entity using the geometry of its physics colliders.
+    //! Collider geometry is usually much coarser than the render mesh, while being sufficient for the lidar resolution.
+    //! The intensity is still taken from the render material of the entity (if it has a MeshComponent).
+    //! The meshes are recreated whenever the colliders change (e.g. when the asset of a mesh collider finishes loading).
+    class ColliderEntityManager
+        : public EntityManager
+        , protected Physics::ColliderComponentEventBus::Handler
+        , protected AZ::Render::MeshComponentNotificationBus::Handler
+        , protected AZ::Render::MaterialComponentNotificationBus::Handler
+    {
+    public:
+        explicit ColliderEntityManager(AZ::EntityId entityId);
+        ColliderEntityManager(const ColliderEntityManager& other) = delete;
+        ColliderEntityManager(ColliderEntityManager&& other) = delete;
+        ColliderEntityManager& operator=(ColliderEntityManager&& rhs) = delete;
+        ColliderEntityManager& operator=(const ColliderEntityManager&) = delete;
+        ~ColliderEntityManager();
+
+        void CollectMemoryUsage(MemoryUsageReport& report) const override;
+
+    protected:
+        // AZ::EntityBus::Handler implementation overrides
+        void OnEntityActivated(const AZ::EntityId& entityId) override;
+        void OnEntityDeactivated(const AZ::EntityId& entityId) override;
+
+        // Physics::ColliderComponentEventBus overrides
+        void OnColliderChanged() override;
+
+        // AZ::Render::MeshComponentNotificationBus overrides
+        void OnModelReady(
+            const AZ::Data::Asset<AZ::RPI::ModelAsset>& modelAsset,
+            [[maybe_unused]] const AZ::Data::Instance<AZ::RPI::Model>& model) override;
+        void OnModelPreDestroy() override;
+
+        // AZ::Render::MaterialComponentNotificationBus overrides
+        void OnMaterialsUpdated(const AZ::Render::MaterialAssignmentMap& materials) override;
+
+        // ModelLibraryNotificationBus overrides
+        void OnMaterialTextureReady(const Wrappers::RglTexture& placeholder, const Wrappers::RglTexture& texture) override;
+
+    private:
+        //! Creates an RGL mesh for each collider shape of the entity.
+        //! Heightfield colliders are skipped, since they are handled by the terrain entity manager.
+        void ProcessColliderShapes();
+        void ClearColliderMeshes();
+        void SetIntensityTextureForAllMeshes(const Wrappers::RglTexture& texture);
+
+        AZStd::vector<Wrappers::RglMesh> m_colliderMeshes;
+        //! Material slot of the render mesh used to determine the intensity of all collider meshes.
+        AZ::RPI::ModelMaterialSlot::StableId m_intensityMaterialSlotId{ AZ::RPI::ModelMaterialSlot::InvalidStableId };
+        const Wrappers::RglTexture* m_intensityTexture{ nullptr };
+    };
+} // namespace RGL
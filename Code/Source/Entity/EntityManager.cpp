@@ -13,11 +13,16 @@
  * limitations under the License.
  */
 
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/std/algorithm.h>
+#include <AzFramework/Visibility/BoundsBus.h>
 #include <Entity/EntityManager.h>
 #include <LmbrCentral/Scripting/TagComponentBus.h>
 #include <RGL/RGLBus.h>
 #include <ROS2Sensors/Lidar/SegmentationUtils.h>
 #include <Utilities/RGLUtils.h>
+#include <Wrappers/RglMesh.h>
+#include <Wrappers/RglTexture.h>
 
 namespace RGL
 {
@@ -29,9 +34,24 @@ namespace RGL
 
     EntityManager::~EntityManager()
     {
+        ModelLibraryNotificationBus::MultiHandler::BusDisconnect();
         AZ::EntityBus::Handler::BusDisconnect();
     }
 
+    bool EntityManager::PrepareParallelUpdate()
+    {
+        return false;
+    }
+
+    void EntityManager::UpdateInParallel()
+    {
+    }
+
+    const void* EntityManager::GetParallelUpdateGroup() const
+    {
+        return nullptr;
+    }
+
     void EntityManager::Update()
     {
         if (!m_isPoseUpdateNeeded)
@@ -42,6 +62,270 @@ namespace RGL
         UpdatePose();
     }
 
+    void EntityManager::CollectMemoryUsage([[maybe_unused]] MemoryUsageReport& report) const
+    {
+    }
+
+    void EntityManager::SetIsResident(bool isResident)
+    {
+        if (m_isResident == isResident)
+        {
+            return;
+        }
+
+        m_isResident = isResident;
+        UpdateRglEntityPresence();
+    }
+
+    bool EntityManager::IsResident() const
+    {
+        return m_isResident;
+    }
+
+    bool EntityManager::IsWorldBoundsUpdateNeeded() const
+    {
+        return m_isWorldBoundsUpdateNeeded;
+    }
+
+    AZ::Aabb EntityManager::UpdateWorldBounds()
+    {
+        m_worldBounds = AZ::Aabb::CreateNull();
+        AzFramework::BoundsRequestBus::EventResult(m_worldBounds, m_entityId, &AzFramework::BoundsRequestBus::Events::GetWorldBounds);
+        m_isWorldBoundsUpdateNeeded = false;
+        return m_worldBounds;
+    }
+
+    AZ::EntityId EntityManager::GetEntityId() const
+    {
+        return m_entityId;
+    }
+
+    bool EntityManager::IsBatchable() const
+    {
+        return false;
+    }
+
+    void EntityManager::AppendBatchGeometry(
+        [[maybe_unused]] const Wrappers::RglTexture* intensityTexture, [[maybe_unused]] BatchGeometry& geometry) const
+    {
+    }
+
+    void EntityManager::CollectIntensityTextures(AZStd::vector<const Wrappers::RglTexture*>& textures) const
+    {
+        for (const RglEntityDescription& description : m_entityDescriptions)
+        {
+            if (AZStd::find(textures.begin(), textures.end(), description.m_intensityTexture) == textures.end())
+            {
+                textures.push_back(description.m_intensityTexture);
+            }
+        }
+    }
+
+    void EntityManager::SetIsBatched(bool isBatched)
+    {
+        if (m_isBatched == isBatched)
+        {
+            return;
+        }
+
+        m_isBatched = isBatched;
+        UpdateRglEntityPresence();
+    }
+
+    bool EntityManager::IsBatched() const
+    {
+        return m_isBatched;
+    }
+
+    bool EntityManager::IsTransformStatic() const
+    {
+        return m_isTransformStatic;
+    }
+
+    AZ::u32 EntityManager::GetTransformChangeCount() const
+    {
+        return m_transformChangeCount;
+    }
+
+    AZ::u32 EntityManager::GetGeometryChangeCount() const
+    {
+        return m_geometryChangeCount;
+    }
+
+    AZ::u32 EntityManager::GetIntensityChangeCount() const
+    {
+        return m_intensityChangeCount;
+    }
+
+    AZ::Vector3 EntityManager::GetWorldTranslation() const
+    {
+        return m_worldTm.GetTranslation();
+    }
+
+    const AZStd::optional<int32_t>& EntityManager::GetPackedRglEntityId() const
+    {
+        return m_packedRglEntityId;
+    }
+
+    void EntityManager::SetLidarObservation(float distance, float angularResolution, float rangeExcess)
+    {
+        m_lidarObservationDistance = distance;
+        m_lidarObservationAngularResolution = angularResolution;
+        m_lidarRangeExcess = rangeExcess;
+    }
+
+    bool EntityManager::AddRglEntity(const Wrappers::RglMesh& mesh, const Wrappers::RglTexture* intensityTexture)
+    {
+        const RglEntityDescription description{ &mesh, intensityTexture };
+        if (AreRglEntitiesPresent())
+        {
+            Wrappers::RglEntity entity = CreateRglEntity(description);
+            if (!entity.IsValid())
+            {
+                return false;
+            }
+
+            m_entities.emplace_back(AZStd::move(entity));
+        }
+
+        m_entityDescriptions.push_back(description);
+        m_isPoseUpdateNeeded = true;
+        m_isWorldBoundsUpdateNeeded = true;
+        ++m_geometryChangeCount;
+        return true;
+    }
+
+    void EntityManager::SetRglEntityMesh(size_t entityIdx, const Wrappers::RglMesh& mesh)
+    {
+        AZ_Assert(entityIdx < m_entityDescriptions.size(), "Tried to set mesh of a non-existent entity.");
+        RglEntityDescription& description = m_entityDescriptions[entityIdx];
+        description.m_mesh = &mesh;
+        ++m_geometryChangeCount;
+        if (AreRglEntitiesPresent())
+        {
+            m_entities[entityIdx] = CreateRglEntity(description);
+            m_isPoseUpdateNeeded = true;
+        }
+    }
+
+    void EntityManager::SetIntensityTexture(size_t entityIdx, const Wrappers::RglTexture& texture)
+    {
+        AZ_Assert(entityIdx < m_entityDescriptions.size(), "Tried to set intensity texture of a non-existent entity.");
+        m_entityDescriptions[entityIdx].m_intensityTexture = &texture;
+        ++m_intensityChangeCount;
+        if (AreRglEntitiesPresent() && m_entities[entityIdx].IsValid())
+        {
+            m_entities[entityIdx].SetIntensityTexture(texture);
+        }
+    }
+
+    void EntityManager::ClearRglEntities()
+    {
+        m_entities.clear();
+        m_entityDescriptions.clear();
+        m_isWorldBoundsUpdateNeeded = true;
+        ++m_geometryChangeCount;
+    }
+
+    AZ::Matrix3x4 EntityManager::CalculateRglEntityPose() const
+    {
+        AZ::Transform worldTm = m_worldTm;
+        if (!m_isScaleAppliedToPose)
+        {
+            worldTm.SetUniformScale(1.0f);
+        }
+
+        AZ::Matrix3x4 pose = AZ::Matrix3x4::CreateFromTransform(worldTm);
+        if (m_isScaleAppliedToPose && m_nonUniformScale.has_value())
+        {
+            pose *= AZ::Matrix3x4::CreateScale(m_nonUniformScale.value());
+        }
+
+        return pose;
+    }
+
+    float EntityManager::GetExpectedLidarHitCount(float distanceFactor) const
+    {
+        static constexpr float Infinity = AZStd::numeric_limits<float>::infinity();
+        // Entities outside of the range of all lidars are not hit at all.
+        if (m_lidarObservationDistance == Infinity || m_lidarRangeExcess > 0.0f)
+        {
+            return 0.0f;
+        }
+
+        // A lidar within the entity bounds may hit it with any number of rays.
+        const float distance = m_lidarObservationDistance * distanceFactor;
+        if (distance <= AZ::Constants::FloatEpsilon || m_lidarObservationAngularResolution <= 0.0f || !m_worldBounds.IsValid())
+        {
+            return Infinity;
+        }
+
+        // The entity is approximated with its bounding sphere, which spans (2 * radius / distance) radians as seen by the lidar.
+        const float raysAcross = m_worldBounds.GetExtents().GetLength() / (distance * m_lidarObservationAngularResolution);
+        return raysAcross * raysAcross;
+    }
+
+    float EntityManager::GetLidarObservationDistance() const
+    {
+        return m_lidarObservationDistance;
+    }
+
+    bool EntityManager::IsWithinLidarRange() const
+    {
+        return m_lidarRangeExcess <= 0.0f;
+    }
+
+    Wrappers::RglEntity EntityManager::CreateRglEntity(const RglEntityDescription& description) const
+    {
+        Wrappers::RglEntity entity(*description.m_mesh);
+        if (!entity.IsValid())
+        {
+            return entity;
+        }
+
+        if (description.m_intensityTexture && description.m_intensityTexture->IsValid())
+        {
+            entity.SetIntensityTexture(*description.m_intensityTexture);
+        }
+
+        if (m_packedRglEntityId.has_value())
+        {
+            entity.SetId(m_packedRglEntityId.value());
+        }
+
+        return entity;
+    }
+
+    bool EntityManager::AreRglEntitiesPresent() const
+    {
+        return m_isResident && !m_isBatched;
+    }
+
+    void EntityManager::UpdateRglEntityPresence()
+    {
+        if (!AreRglEntitiesPresent())
+        {
+            m_entities.clear();
+            return;
+        }
+
+        if (!m_entities.empty())
+        {
+            return;
+        }
+
+        m_entities.reserve(m_entityDescriptions.size());
+        for (const RglEntityDescription& description : m_entityDescriptions)
+        {
+            // Invalid entities are stored as well to keep the indices consistent with the descriptions.
+            m_entities.emplace_back(CreateRglEntity(description));
+        }
+
+        // The pose is applied immediately, since the entities may be recreated after the manager update.
+        UpdatePose();
+        OnRglEntitiesRecreated();
+    }
+
     void EntityManager::OnEntityActivated(const AZ::EntityId& entityId)
     {
         //// Transform
@@ -57,7 +341,10 @@ namespace RGL
         // Get current non-uniform scale (if there is no non-uniform scale added, the value won't be changed (nullopt))
         AZ::NonUniformScaleRequestBus::EventResult(m_nonUniformScale, entityId, &AZ::NonUniformScaleRequests::GetScale);
 
+        AZ::TransformBus::EventResult(m_isTransformStatic, entityId, &AZ::TransformBus::Events::IsStaticTransform);
+
         m_isPoseUpdateNeeded = true;
+        m_isWorldBoundsUpdateNeeded = true;
         SetPackedRglEntityId();
     }
 
@@ -67,6 +354,32 @@ namespace RGL
         m_nonUniformScaleChangedHandler.Disconnect();
     }
 
+    void EntityManager::OnMaterialTextureReady(const Wrappers::RglTexture& placeholder, const Wrappers::RglTexture& texture)
+    {
+        for (size_t entityIdx = 0U; entityIdx < m_entityDescriptions.size(); ++entityIdx)
+        {
+            if (m_entityDescriptions[entityIdx].m_intensityTexture == &placeholder)
+            {
+                SetIntensityTexture(entityIdx, texture);
+            }
+        }
+
+        // Each placeholder is replaced only once.
+        ModelLibraryNotificationBus::MultiHandler::BusDisconnect(&placeholder);
+    }
+
+    const Wrappers::RglTexture& EntityManager::StoreMaterialTexture(const AZ::Data::Asset<AZ::RPI::MaterialAsset>& materialAsset)
+    {
+        ModelLibraryRequests* modelLibrary = ModelLibraryInterface::Get();
+        const Wrappers::RglTexture& texture = modelLibrary->StoreMaterialAsset(materialAsset);
+        if (modelLibrary->IsPlaceholderTexture(texture))
+        {
+            ModelLibraryNotificationBus::MultiHandler::BusConnect(&texture);
+        }
+
+        return texture;
+    }
+
     void EntityManager::UpdatePose()
     {
         if (m_entities.empty())
@@ -75,27 +388,31 @@ namespace RGL
             return;
         }
 
-        AZ::Matrix3x4 transform3x4f = AZ::Matrix3x4::CreateFromTransform(m_worldTm);
-        if (m_nonUniformScale.has_value())
-        {
-            transform3x4f *= AZ::Matrix3x4::CreateScale(m_nonUniformScale.value());
-        }
-
-        const rgl_mat3x4f entityPoseRgl = Utils::RglMat3x4FromAzMatrix3x4(transform3x4f);
+        const rgl_mat3x4f entityPoseRgl = Utils::RglMat3x4FromAzMatrix3x4(CalculateRglEntityPose());
         for (Wrappers::RglEntity& entity : m_entities)
         {
-            entity.SetTransform(entityPoseRgl);
+            if (entity.IsValid())
+            {
+                entity.SetTransform(entityPoseRgl);
+            }
         }
 
         m_isPoseUpdateNeeded = false;
     }
 
+    void EntityManager::OnRglEntitiesRecreated()
+    {
+    }
+
     void EntityManager::SetPackedRglEntityId()
     {
         m_packedRglEntityId = CalculatePackedRglEntityId();
         for (Wrappers::RglEntity& entity : m_entities)
         {
-            entity.SetId(m_packedRglEntityId.value());
+            if (entity.IsValid())
+            {
+                entity.SetId(m_packedRglEntityId.value());
+            }
         }
     }
 
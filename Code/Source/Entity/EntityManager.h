@@ -18,20 +18,40 @@
 #include <AzCore/Component/EntityId.h>
 #include <AzCore/Component/NonUniformScaleBus.h>
 #include <AzCore/Component/TransformBus.h>
+#include <AzCore/Math/Aabb.h>
 #include <AzCore/std/containers/vector.h>
+#include <AzCore/std/limits.h>
 #include <AzCore/std/optional.h>
+#include <Model/ModelLibraryBus.h>
+#include <RGL/MemoryUsageBus.h>
 #include <ROS2Sensors/Lidar/ClassSegmentationBus.h>
 #include <Wrappers/RglEntity.h>
 #include <rgl/api/core.h>
 
 namespace RGL
 {
+    namespace Wrappers
+    {
+        class RglMesh;
+        class RglTexture;
+    } // namespace Wrappers
+
+    //! Geometry of RGL entities sharing an intensity texture, with the entity transforms baked into the vertices.
+    struct BatchGeometry
+    {
+        AZStd::vector<rgl_vec3f> m_vertices;
+        AZStd::vector<rgl_vec3i> m_indices;
+        AZStd::vector<rgl_vec2f> m_uvs; //!< Either empty or matching m_vertices.
+    };
+
     //! Base class for Entity Manager.
     //! Although it already implements the EntityBus handler,
     //! the derived classes have to handle bus connection
     //! through BusConnect and BusDisconnect function calls.
     //! This is to allow for further overrides.
-    class EntityManager : public AZ::EntityBus::Handler
+    class EntityManager
+        : public AZ::EntityBus::Handler
+        , protected ModelLibraryNotificationBus::MultiHandler
     {
     public:
         explicit EntityManager(AZ::EntityId entityId);
@@ -41,22 +61,132 @@ namespace RGL
         EntityManager& operator=(const EntityManager&) = delete;
         virtual ~EntityManager();
 
+        //! Decides whether the manager has CPU work (e.g. mesh deformation) to be done in parallel with other managers.
+        //! Called on the main thread before UpdateInParallel.
+        //! @return True if UpdateInParallel has to be called in the current scene update.
+        virtual bool PrepareParallelUpdate();
+        //! Performs the CPU work of the manager. Called from worker jobs, before Update.
+        //! It must neither call the RGL API nor modify data shared with other managers, except for the data of its update group.
+        virtual void UpdateInParallel();
+        //! Returns the key of the data shared with other managers and modified in UpdateInParallel (e.g. an EMotionFX actor).
+        //! Managers with the same key are updated serially, within the same job. Managers returning nullptr share no data.
+        [[nodiscard]] virtual const void* GetParallelUpdateGroup() const;
         virtual void Update();
 
+        //! Adds the memory used by RGL objects owned exclusively by this EntityManager to the report.
+        //! Data shared through the ModelLibrary is reported by the library itself.
+        virtual void CollectMemoryUsage(MemoryUsageReport& report) const;
+
+        //! Adds (or removes) RGL entities of this EntityManager to (or from) the RGL scene.
+        //! Non-resident managers keep their meshes, textures and material mappings,
+        //! so that making them resident again only requires recreating the RGL entities.
+        void SetIsResident(bool isResident);
+        [[nodiscard]] bool IsResident() const;
+
+        //! Returns true if the world bounds of the entity may have changed since the last UpdateWorldBounds call.
+        [[nodiscard]] bool IsWorldBoundsUpdateNeeded() const;
+        //! Fetches the current world bounds of the entity.
+        //! The returned AABB is invalid if the entity does not provide bounds.
+        AZ::Aabb UpdateWorldBounds();
+
+        [[nodiscard]] AZ::EntityId GetEntityId() const;
+
+        //! Returns true if the geometry of this manager can be merged into static batches.
+        [[nodiscard]] virtual bool IsBatchable() const;
+        //! Appends the world-space geometry of all RGL entities using the provided intensity texture.
+        virtual void AppendBatchGeometry(const Wrappers::RglTexture* intensityTexture, BatchGeometry& geometry) const;
+        //! Collects the distinct intensity textures used by the RGL entities of this manager.
+        void CollectIntensityTextures(AZStd::vector<const Wrappers::RglTexture*>& textures) const;
+
+        //! Removes (or restores) RGL entities of this manager, since its geometry is (or no longer is) a part of static batches.
+        void SetIsBatched(bool isBatched);
+        [[nodiscard]] bool IsBatched() const;
+
+        //! Returns true if the entity transform was marked as static.
+        [[nodiscard]] bool IsTransformStatic() const;
+        //! Number of transform changes since the manager creation. Used to detect movement of the entity.
+        [[nodiscard]] AZ::u32 GetTransformChangeCount() const;
+        //! Number of geometry changes since the manager creation. Intensity texture changes are not counted.
+        [[nodiscard]] AZ::u32 GetGeometryChangeCount() const;
+        //! Number of intensity texture changes since the manager creation.
+        [[nodiscard]] AZ::u32 GetIntensityChangeCount() const;
+        [[nodiscard]] AZ::Vector3 GetWorldTranslation() const;
+        [[nodiscard]] const AZStd::optional<int32_t>& GetPackedRglEntityId() const;
+
+        //! Sets parameters of the lidar observing this entity with the highest density of rays.
+        //! @param distance Distance between the lidar and the entity bounds. Infinity if no lidar observes the entity.
+        //! @param angularResolution Angular resolution of the lidar (in radians). Zero if unknown.
+        //! @param rangeExcess Distance by which the entity bounds exceed the range of the closest lidar. Non-positive if within range.
+        void SetLidarObservation(float distance, float angularResolution, float rangeExcess);
+
     protected:
+        //! Describes an RGL entity managed by this EntityManager.
+        //! Descriptions outlive the RGL entities, which allows for their cheap recreation.
+        struct RglEntityDescription
+        {
+            const Wrappers::RglMesh* m_mesh{ nullptr };
+            const Wrappers::RglTexture* m_intensityTexture{ nullptr };
+        };
+
         // AZ::EntityBus::Handler implementation overrides
         void OnEntityActivated(const AZ::EntityId& entityId) override;
         void OnEntityDeactivated(const AZ::EntityId& entityId) override;
 
+        // ModelLibraryNotificationBus overrides
+        void OnMaterialTextureReady(const Wrappers::RglTexture& placeholder, const Wrappers::RglTexture& texture) override;
+
+        //! Returns the texture of the material asset stored by the model library.
+        //! If the texture is a placeholder, OnMaterialTextureReady is called once it is replaced with the image texture.
+        const Wrappers::RglTexture& StoreMaterialTexture(const AZ::Data::Asset<AZ::RPI::MaterialAsset>& materialAsset);
+
         //! Updates poses of all RGL entities managed by this EntityManager.
         virtual void UpdatePose();
+        //! Called after the RGL entities are recreated from their descriptions, e.g. when the manager becomes resident again.
+        //! Recreated entities use the undeformed geometry of their meshes.
+        virtual void OnRglEntitiesRecreated();
+
+        //! Adds an RGL entity using the provided mesh and intensity texture.
+        //! Both must outlive the entity (or until ClearRglEntities is called).
+        //! @return False if the manager is resident and the RGL entity creation failed.
+        bool AddRglEntity(const Wrappers::RglMesh& mesh, const Wrappers::RglTexture* intensityTexture);
+        //! Replaces the mesh of the RGL entity at the provided index. The mesh must outlive the entity.
+        //! Since RGL entities cannot change their meshes, the entity is recreated if present.
+        void SetRglEntityMesh(size_t entityIdx, const Wrappers::RglMesh& mesh);
+        //! Sets the intensity texture of the RGL entity at the provided index.
+        void SetIntensityTexture(size_t entityIdx, const Wrappers::RglTexture& texture);
+        //! Destroys all RGL entities along with their descriptions.
+        void ClearRglEntities();
+
+        //! Returns the pose applied to all RGL entities of this manager.
+        [[nodiscard]] AZ::Matrix3x4 CalculateRglEntityPose() const;
+
+        //! Estimates the number of lidar rays hitting the entity based on its bounds and the last lidar observation.
+        //! @param distanceFactor Factor the observation distance is multiplied by before the estimation.
+        //! @return Zero if no lidar observes the entity within its range. Infinity if the lidar is within the entity bounds,
+        //! the angular resolution of the lidar is unknown or the entity bounds are invalid.
+        [[nodiscard]] float GetExpectedLidarHitCount(float distanceFactor) const;
+        //! Returns the distance to the lidar passed with the last observation. Infinity if no lidar observes the entity.
+        [[nodiscard]] float GetLidarObservationDistance() const;
+        //! Returns true if the entity was within the range of any lidar during the last observation.
+        [[nodiscard]] bool IsWithinLidarRange() const;
 
         AZ::EntityId m_entityId;
+        //! Descriptions of all RGL entities managed by this EntityManager.
+        AZStd::vector<RglEntityDescription> m_entityDescriptions;
+        //! RGL entities created using m_entityDescriptions (with matching indices). Empty if the manager is not resident.
         AZStd::vector<Wrappers::RglEntity> m_entities;
         AZStd::optional<int32_t> m_packedRglEntityId;
         bool m_isPoseUpdateNeeded{ false };
+        bool m_isWorldBoundsUpdateNeeded{ false };
+        //! Set to false by managers whose meshes already include the entity scale (e.g. physics collider geometry).
+        bool m_isScaleAppliedToPose{ true };
 
     private:
+        Wrappers::RglEntity CreateRglEntity(const RglEntityDescription& description) const;
+        //! RGL entities are present in the scene only if the manager is resident and not batched.
+        [[nodiscard]] bool AreRglEntitiesPresent() const;
+        //! Creates or destroys RGL entities based on the residency and batching state.
+        void UpdateRglEntityPresence();
         void SetPackedRglEntityId();
         int32_t CalculatePackedRglEntityId() const;
 
@@ -66,6 +196,8 @@ namespace RGL
             {
                 m_worldTm = world;
                 m_isPoseUpdateNeeded = true;
+                m_isWorldBoundsUpdateNeeded = true;
+                ++m_transformChangeCount;
             }};
 
         AZ::NonUniformScaleChangedEvent::Handler m_nonUniformScaleChangedHandler{[this](
@@ -73,11 +205,23 @@ namespace RGL
             {
                 m_nonUniformScale = scale;
                 m_isPoseUpdateNeeded = true;
+                m_isWorldBoundsUpdateNeeded = true;
+                ++m_transformChangeCount;
             }};
         // clang-format on
 
         AZ::Transform m_worldTm{ AZ::Transform::CreateIdentity() };
         AZStd::optional<AZ::Vector3> m_nonUniformScale{ AZStd::nullopt };
+        AZ::Aabb m_worldBounds{ AZ::Aabb::CreateNull() };
+        float m_lidarObservationDistance{ AZStd::numeric_limits<float>::infinity() };
+        float m_lidarObservationAngularResolution{ 0.0f };
+        float m_lidarRangeExcess{ 0.0f };
         int32_t m_segmentationEntityId{ 0 };
+        AZ::u32 m_transformChangeCount{ 0U };
+        AZ::u32 m_geometryChangeCount{ 0U };
+        AZ::u32 m_intensityChangeCount{ 0U };
+        bool m_isResident{ true };
+        bool m_isBatched{ false };
+        bool m_isTransformStatic{ false };
     };
 } // namespace RGL
@@ -0,0 +1,201 @@
+/* Copyright 2024, Robotec.ai sp. z o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/math.h>
+#include <Entity/EntitySpatialIndex.h>
+
+namespace RGL
+{
+    namespace
+    {
+        void EraseFromBucket(AZStd::vector<AZ::EntityId>& bucket, AZ::EntityId entityId)
+        {
+            if (auto it = AZStd::find(bucket.begin(), bucket.end(), entityId); it != bucket.end())
+            {
+                *it = bucket.back();
+                bucket.pop_back();
+            }
+        }
+    } // namespace
+
+    size_t EntitySpatialIndex::CellRange::GetCellCount() const
+    {
+        if (m_maxX < m_minX || m_maxY < m_minY)
+        {
+            return 0U;
+        }
+
+        return static_cast<size_t>(m_maxX - m_minX + 1) * static_cast<size_t>(m_maxY - m_minY + 1);
+    }
+
+    void EntitySpatialIndex::Update(AZ::EntityId entityId, const AZ::Aabb& worldBounds)
+    {
+        if (auto it = m_entries.find(entityId); it != m_entries.end())
+        {
+            Erase(entityId, it->second);
+            it->second.m_bounds = worldBounds;
+            Insert(entityId, it->second);
+            return;
+        }
+
+        Entry& entry = m_entries[entityId];
+        entry.m_bounds = worldBounds;
+        Insert(entityId, entry);
+    }
+
+    void EntitySpatialIndex::Remove(AZ::EntityId entityId)
+    {
+        if (auto it = m_entries.find(entityId); it != m_entries.end())
+        {
+            Erase(entityId, it->second);
+            m_entries.erase(it);
+        }
+    }
+
+    void EntitySpatialIndex::Clear()
+    {
+        m_entries.clear();
+        m_cells.clear();
+        m_oversizedEntities.clear();
+    }
+
+    void EntitySpatialIndex::Query(const AZ::Vector3& point, float radius, AZStd::vector<QueryResult>& results)
+    {
+        ++m_queryStamp;
+
+        for (const AZ::EntityId entityId : m_oversizedEntities)
+        {
+            const Entry& entry = m_entries[entityId];
+            const float distance = GetDistance(entry.m_bounds, point);
+            if (distance <= radius)
+            {
+                results.emplace_back(entityId, distance);
+            }
+        }
+
+        const AZ::Vector3 radiusVector(radius);
+        const CellRange queryCells = GetCellRange(point - radiusVector, point + radiusVector);
+        for (int32_t x = queryCells.m_minX; x <= queryCells.m_maxX; ++x)
+        {
+            for (int32_t y = queryCells.m_minY; y <= queryCells.m_maxY; ++y)
+            {
+                auto cellIt = m_cells.find(ToCellKey(x, y));
+                if (cellIt == m_cells.end())
+                {
+                    continue;
+                }
+
+                for (const AZ::EntityId entityId : cellIt->second)
+                {
+                    Entry& entry = m_entries[entityId];
+                    if (entry.m_queryStamp == m_queryStamp)
+                    {
+                        continue;
+                    }
+
+                    entry.m_queryStamp = m_queryStamp;
+                    const float distance = GetDistance(entry.m_bounds, point);
+                    if (distance <= radius)
+                    {
+                        results.emplace_back(entityId, distance);
+                    }
+                }
+            }
+        }
+    }
+
+    bool EntitySpatialIndex::IsEmpty() const
+    {
+        return m_entries.empty();
+    }
+
+    int32_t EntitySpatialIndex::ToCellCoordinate(float position)
+    {
+        return static_cast<int32_t>(AZStd::floor(position / CellSize));
+    }
+
+    uint64_t EntitySpatialIndex::ToCellKey(int32_t x, int32_t y)
+    {
+        return (static_cast<uint64_t>(static_cast<uint32_t>(x)) << 32U) | static_cast<uint64_t>(static_cast<uint32_t>(y));
+    }
+
+    EntitySpatialIndex::CellRange EntitySpatialIndex::GetCellRange(const AZ::Vector3& min, const AZ::Vector3& max)
+    {
+        return CellRange{ ToCellCoordinate(min.GetX()), ToCellCoordinate(min.GetY()), ToCellCoordinate(max.GetX()),
+                          ToCellCoordinate(max.GetY()) };
+    }
+
+    float EntitySpatialIndex::GetDistance(const AZ::Aabb& bounds, const AZ::Vector3& point)
+    {
+        if (!bounds.IsValid())
+        {
+            return 0.0f;
+        }
+
+        return bounds.GetDistance(point);
+    }
+
+    void EntitySpatialIndex::Insert(AZ::EntityId entityId, Entry& entry)
+    {
+        entry.m_isOversized = !entry.m_bounds.IsValid();
+        if (!entry.m_isOversized)
+        {
+            entry.m_cells = GetCellRange(entry.m_bounds.GetMin(), entry.m_bounds.GetMax());
+            entry.m_isOversized = entry.m_cells.GetCellCount() > MaxCellsPerEntry;
+        }
+
+        if (entry.m_isOversized)
+        {
+            entry.m_cells = CellRange{};
+            m_oversizedEntities.push_back(entityId);
+            return;
+        }
+
+        for (int32_t x = entry.m_cells.m_minX; x <= entry.m_cells.m_maxX; ++x)
+        {
+            for (int32_t y = entry.m_cells.m_minY; y <= entry.m_cells.m_maxY; ++y)
+            {
+                m_cells[ToCellKey(x, y)].push_back(entityId);
+            }
+        }
+    }
+
+    void EntitySpatialIndex::Erase(AZ::EntityId entityId, const Entry& entry)
+    {
+        if (entry.m_isOversized)
+        {
+            EraseFromBucket(m_oversizedEntities, entityId);
+            return;
+        }
+
+        for (int32_t x = entry.m_cells.m_minX; x <= entry.m_cells.m_maxX; ++x)
+        {
+            for (int32_t y = entry.m_cells.m_minY; y <= entry.m_cells.m_maxY; ++y)
+            {
+                auto cellIt = m_cells.find(ToCellKey(x, y));
+                if (cellIt == m_cells.end())
+                {
+                    continue;
+                }
+
+                EraseFromBucket(cellIt->second, entityId);
+                if (cellIt->second.empty())
+                {
+                    m_cells.erase(cellIt);
+                }
+            }
+        }
+    }
+} // namespace RGL
@@ -0,0 +1,79 @@
+/* Copyright 2024, Robotec.ai sp. z o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <AzCore/Component/EntityId.h>
+#include <AzCore/Math/Aabb.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/utility/pair.h>
+
+namespace RGL
+{
+    //! Uniform grid over the XY plane used to find entities located near a given point.
+    //! Entities spanning too many cells (or with unknown bounds) are stored separately and tested on every query.
+    class EntitySpatialIndex
+    {
+    public:
+        //! Pair of an entity and the distance between its bounds and the query point.
+        using QueryResult = AZStd::pair<AZ::EntityId, float>;
+
+        //! Inserts the entity into the index or updates its bounds if it is already present.
+        void Update(AZ::EntityId entityId, const AZ::Aabb& worldBounds);
+        void Remove(AZ::EntityId entityId);
+        void Clear();
+
+        //! Appends all entities whose bounds are located within the radius from the point to the results.
+        //! Entities with invalid bounds are always reported with a distance of zero.
+        void Query(const AZ::Vector3& point, float radius, AZStd::vector<QueryResult>& results);
+
+        [[nodiscard]] bool IsEmpty() const;
+
+    private:
+        struct CellRange
+        {
+            int32_t m_minX{ 0 };
+            int32_t m_minY{ 0 };
+            int32_t m_maxX{ -1 };
+            int32_t m_maxY{ -1 };
+
+            [[nodiscard]] size_t GetCellCount() const;
+        };
+
+        struct Entry
+        {
+            AZ::Aabb m_bounds{ AZ::Aabb::CreateNull() };
+            CellRange m_cells; //!< Empty for oversized entries.
+            bool m_isOversized{ false };
+            uint32_t m_queryStamp{ 0U }; //!< Used to report entities spanning multiple cells only once per query.
+        };
+
+        static constexpr float CellSize = 32.0f;
+        static constexpr size_t MaxCellsPerEntry = 64U;
+
+        [[nodiscard]] static int32_t ToCellCoordinate(float position);
+        [[nodiscard]] static uint64_t ToCellKey(int32_t x, int32_t y);
+        [[nodiscard]] static CellRange GetCellRange(const AZ::Vector3& min, const AZ::Vector3& max);
+        [[nodiscard]] static float GetDistance(const AZ::Aabb& bounds, const AZ::Vector3& point);
+
+        void Insert(AZ::EntityId entityId, Entry& entry);
+        void Erase(AZ::EntityId entityId, const Entry& entry);
+
+        AZStd::unordered_map<AZ::EntityId, Entry> m_entries;
+        AZStd::unordered_map<uint64_t, AZStd::vector<AZ::EntityId>> m_cells;
+        AZStd::vector<AZ::EntityId> m_oversizedEntities;
+        uint32_t m_queryStamp{ 0U };
+    };
+} // namespace RGL
@@ -26,7 +26,7 @@ namespace RGL
 
     void MaterialEntityManager::OnMaterialsUpdated(const AZ::Render::MaterialAssignmentMap& materials)
     {
-        if (m_entities.empty())
+        if (m_entityDescriptions.empty())
         {
             AZ_Warning(__func__, false, "Skipping material update. The entities were not yet created.");
             return;
@@ -46,23 +46,27 @@ namespace RGL
                 continue;
             }
 
-            const Wrappers::RglTexture& materialTexture = ModelLibraryInterface::Get()->StoreMaterialAsset(assignment.m_materialAsset);
+            const Wrappers::RglTexture& materialTexture = StoreMaterialTexture(assignment.m_materialAsset);
             if (materialTexture.IsValid())
             {
-                size_t meshEntityIdx = GetMeshEntityIdxForMaterialSlotId(assignmentId.m_materialSlotStableId);
-                if (meshEntityIdx == -1)
+                m_materialSlotOverrides[assignmentId.m_materialSlotStableId] = &materialTexture;
+                const AZStd::vector<size_t>* meshEntityIndices = GetMeshEntityIndicesForMaterialSlotId(assignmentId.m_materialSlotStableId);
+                if (!meshEntityIndices)
                 {
                     continue;
                 }
 
-                m_entities[meshEntityIdx].SetIntensityTexture(materialTexture);
+                for (const size_t meshEntityIdx : *meshEntityIndices)
+                {
+                    SetIntensityTexture(meshEntityIdx, materialTexture);
+                }
             }
         }
     }
 
     void MaterialEntityManager::AssignMaterialSlotIdForMesh(AZ::RPI::ModelMaterialSlot::StableId materialSlotId, size_t meshEntityIdx)
     {
-        m_materialSlotMeshIdMap.emplace(materialSlotId, meshEntityIdx);
+        m_materialSlotMeshIdMap[materialSlotId].push_back(meshEntityIdx);
     }
 
     void MaterialEntityManager::ResetMaterialsMapping()
@@ -70,7 +74,32 @@ namespace RGL
         m_materialSlotMeshIdMap.clear();
     }
 
-    size_t MaterialEntityManager::GetMeshEntityIdxForMaterialSlotId(AZ::RPI::ModelMaterialSlot::StableId materialSlotId) const
+    const Wrappers::RglTexture* MaterialEntityManager::GetMaterialSlotOverride(AZ::RPI::ModelMaterialSlot::StableId materialSlotId) const
+    {
+        auto it = m_materialSlotOverrides.find(materialSlotId);
+        return it != m_materialSlotOverrides.end() ? it->second : nullptr;
+    }
+
+    void MaterialEntityManager::ResetMaterialSlotOverrides()
+    {
+        m_materialSlotOverrides.clear();
+    }
+
+    void MaterialEntityManager::OnMaterialTextureReady(const Wrappers::RglTexture& placeholder, const Wrappers::RglTexture& texture)
+    {
+        for (auto& [materialSlotId, slotTexture] : m_materialSlotOverrides)
+        {
+            if (slotTexture == &placeholder)
+            {
+                slotTexture = &texture;
+            }
+        }
+
+        EntityManager::OnMaterialTextureReady(placeholder, texture);
+    }
+
+    const AZStd::vector<size_t>* MaterialEntityManager::GetMeshEntityIndicesForMaterialSlotId(
+        AZ::RPI::ModelMaterialSlot::StableId materialSlotId) const
     {
         auto it = m_materialSlotMeshIdMap.find(materialSlotId);
         if (it == m_materialSlotMeshIdMap.end())
@@ -83,9 +112,9 @@ namespace RGL
                 "Programmer error: Unable to find mesh entity associated with provided material slot id: %u in entity %s.",
                 materialSlotId,
                 entityName.c_str());
-            return -1;
+            return nullptr;
         }
 
-        return it->second;
+        return &it->second;
     }
 } // namespace RGL
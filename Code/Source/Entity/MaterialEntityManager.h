@@ -38,15 +38,27 @@ namespace RGL
         ~MaterialEntityManager() = default;
 
     protected:
-        size_t GetMeshEntityIdxForMaterialSlotId(AZ::RPI::ModelMaterialSlot::StableId materialSlotId) const;
+        //! Returns indices of all mesh entities using the material slot or nullptr if the slot is not used by any entity.
+        const AZStd::vector<size_t>* GetMeshEntityIndicesForMaterialSlotId(AZ::RPI::ModelMaterialSlot::StableId materialSlotId) const;
 
+        //! Associates the mesh entity with the material slot. A single slot can be used by multiple entities.
         void AssignMaterialSlotIdForMesh(AZ::RPI::ModelMaterialSlot::StableId materialSlotId, size_t meshEntityIdx);
         void ResetMaterialsMapping();
 
+        //! Returns the texture of the material assigned to the slot through the material component.
+        //! Returns nullptr if the slot uses its default material.
+        const Wrappers::RglTexture* GetMaterialSlotOverride(AZ::RPI::ModelMaterialSlot::StableId materialSlotId) const;
+        void ResetMaterialSlotOverrides();
+
+        // ModelLibraryNotificationBus overrides
+        void OnMaterialTextureReady(const Wrappers::RglTexture& placeholder, const Wrappers::RglTexture& texture) override;
+
     private:
         // AZ::Render::MaterialComponentNotificationBus implementation overrides
         void OnMaterialsUpdated(const AZ::Render::MaterialAssignmentMap& materials) override;
 
-        AZStd::unordered_map<AZ::RPI::ModelMaterialSlot::StableId, size_t> m_materialSlotMeshIdMap;
+        AZStd::unordered_map<AZ::RPI::ModelMaterialSlot::StableId, AZStd::vector<size_t>> m_materialSlotMeshIdMap;
+        //! Textures of materials assigned through the material component, kept to be reapplied when the meshes are recreated.
+        AZStd::unordered_map<AZ::RPI::ModelMaterialSlot::StableId, const Wrappers::RglTexture*> m_materialSlotOverrides;
     };
 } // namespace RGL
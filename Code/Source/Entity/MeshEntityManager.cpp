@@ -16,6 +16,7 @@
 #include <AtomLyIntegration/CommonFeatures/Material/MaterialComponentConstants.h>
 #include <Entity/MeshEntityManager.h>
 #include <Model/ModelLibraryBus.h>
+#include <RGL/RGLBus.h>
 #include <Utilities/RGLUtils.h>
 #include <Wrappers/RglEntity.h>
 #include <Wrappers/RglMesh.h>
@@ -49,13 +50,142 @@ namespace RGL
         MaterialEntityManager::OnEntityDeactivated(entityId);
     }
 
+    void MeshEntityManager::Update()
+    {
+        if (m_modelAsset.IsReady())
+        {
+            if (const size_t lodIndex = SelectLod(); lodIndex != m_currentLod)
+            {
+                CreateLodEntities(lodIndex);
+            }
+        }
+
+        MaterialEntityManager::Update();
+    }
+
+    bool MeshEntityManager::IsBatchable() const
+    {
+        return m_modelAsset.IsReady() && !m_entityDescriptions.empty();
+    }
+
+    void MeshEntityManager::AppendBatchGeometry(const Wrappers::RglTexture* intensityTexture, BatchGeometry& geometry) const
+    {
+        const auto lodAssets = m_modelAsset->GetLodAssets();
+        const auto meshes = lodAssets[AZStd::min(m_currentLod, lodAssets.size() - 1U)]->GetMeshes();
+        const AZ::Matrix3x4 pose = CalculateRglEntityPose();
+        for (size_t entityIdx = 0U; entityIdx < m_entityDescriptions.size(); ++entityIdx)
+        {
+            if (m_entityDescriptions[entityIdx].m_intensityTexture != intensityTexture)
+            {
+                continue;
+            }
+
+            const auto& mesh = meshes[m_entityMeshIndices[entityIdx]];
+            const AZStd::span<const rgl_vec3f> vertices = mesh.GetSemanticBufferTyped<rgl_vec3f>(AZ::Name("POSITION"));
+            const AZStd::span<const rgl_vec3i> indices = mesh.GetIndexBufferTyped<rgl_vec3i>();
+            const AZStd::span<const rgl_vec2f> uvs = mesh.GetSemanticBufferTyped<rgl_vec2f>(AZ::Name("UV"));
+
+            const auto vertexOffset = aznumeric_cast<int32_t>(geometry.m_vertices.size());
+            for (const rgl_vec3f& vertex : vertices)
+            {
+                geometry.m_vertices.push_back(Utils::RglVector3FromAzVec3f(pose * Utils::AzVector3FromRglVec3f(vertex)));
+            }
+
+            for (const rgl_vec3i& triangle : indices)
+            {
+                geometry.m_indices.push_back({ {
+                    triangle.value[0] + vertexOffset,
+                    triangle.value[1] + vertexOffset,
+                    triangle.value[2] + vertexOffset,
+                } });
+            }
+
+            // UVs are kept only if all merged meshes provide them.
+            if (uvs.size() == vertices.size() && geometry.m_uvs.size() == aznumeric_cast<size_t>(vertexOffset))
+            {
+                geometry.m_uvs.insert(geometry.m_uvs.end(), uvs.begin(), uvs.end());
+            }
+            else
+            {
+                geometry.m_uvs.clear();
+            }
+        }
+    }
+
     void MeshEntityManager::OnModelReady(
         const AZ::Data::Asset<AZ::RPI::ModelAsset>& modelAsset, [[maybe_unused]] const AZ::Data::Instance<AZ::RPI::Model>& model)
     {
-        AZ_Assert(m_entities.empty(), "Entity Manager for entity with ID: %s has an invalid state.", m_entityId.ToString().c_str());
-        auto* modelLibrary = ModelLibraryInterface::Get();
-        const MeshMaterialSlotPairList& meshes = modelLibrary->StoreModelAsset(modelAsset);
+        AZ_Assert(
+            m_entityDescriptions.empty(), "Entity Manager for entity with ID: %s has an invalid state.", m_entityId.ToString().c_str());
 
+        m_modelAsset = modelAsset;
+        m_lodTriangleCounts.clear();
+        for (const auto& lodAsset : modelAsset->GetLodAssets())
+        {
+            size_t triangleCount = 0U;
+            for (const auto& mesh : lodAsset->GetMeshes())
+            {
+                triangleCount += mesh.GetIndexCount() / 3U;
+            }
+            m_lodTriangleCounts.push_back(triangleCount);
+        }
+
+        CreateLodEntities(SelectLod());
+
+        // We can use material info only when the model is ready.
+        AZ::Render::MaterialComponentNotificationBus::Handler::BusConnect(m_entityId);
+    }
+
+    void MeshEntityManager::OnModelPreDestroy()
+    {
+        AZ::Render::MaterialComponentNotificationBus::Handler::BusDisconnect();
+        ResetMaterialsMapping();
+        ResetMaterialSlotOverrides();
+        ClearRglEntities();
+        m_entityMeshIndices.clear();
+        m_modelAsset.Reset();
+        m_lodTriangleCounts.clear();
+        m_currentLod = 0U;
+    }
+
+    size_t MeshEntityManager::SelectLod() const
+    {
+        const LodSelectionConfiguration& lodConfig = RGLInterface::Get()->GetSceneConfiguration().m_lodSelectionConfig;
+        if (!lodConfig.m_isEnabled || m_lodTriangleCounts.size() < 2U)
+        {
+            return 0U;
+        }
+
+        // Finer LODs are selected immediately, since they never degrade the point cloud.
+        const size_t lodIndex = FindCoarsestSufficientLod(GetExpectedLidarHitCount(1.0f), lodConfig.m_trianglesPerHit);
+        if (lodIndex <= m_currentLod)
+        {
+            return lodIndex;
+        }
+
+        const float hysteresisDistanceFactor = 1.0f / (1.0f + lodConfig.m_hysteresis);
+        return AZStd::max(
+            m_currentLod, FindCoarsestSufficientLod(GetExpectedLidarHitCount(hysteresisDistanceFactor), lodConfig.m_trianglesPerHit));
+    }
+
+    size_t MeshEntityManager::FindCoarsestSufficientLod(float expectedHitCount, float trianglesPerHit) const
+    {
+        const float requiredTriangleCount = expectedHitCount * trianglesPerHit;
+        for (size_t lodIndex = m_lodTriangleCounts.size() - 1U; lodIndex > 0U; --lodIndex)
+        {
+            if (aznumeric_cast<float>(m_lodTriangleCounts[lodIndex]) >= requiredTriangleCount)
+            {
+                return lodIndex;
+            }
+        }
+
+        return 0U;
+    }
+
+    void MeshEntityManager::CreateLodEntities(size_t lodIndex)
+    {
+        auto* modelLibrary = ModelLibraryInterface::Get();
+        const MeshMaterialSlotPairList& meshes = modelLibrary->StoreModelAsset(m_modelAsset, lodIndex);
         if (meshes.empty())
         {
             AZ_Assert(
@@ -63,40 +193,35 @@ namespace RGL
             return;
         }
 
-        m_entities.reserve(meshes.size());
+        ClearRglEntities();
+        ResetMaterialsMapping();
+        m_entityMeshIndices.clear();
+        m_currentLod = lodIndex;
+
+        m_entityDescriptions.reserve(meshes.size());
         size_t entityIdx = 0;
-        for (const auto& [mesh, matSlot] : meshes)
+        for (size_t meshIdx = 0; meshIdx < meshes.size(); ++meshIdx)
         {
-            Wrappers::RglEntity entity(mesh);
-            if (entity.IsValid())
+            const auto& [mesh, matSlot] = meshes[meshIdx];
+            if (!mesh.IsValid())
+            {
+                continue;
+            }
+
+            const Wrappers::RglTexture* texture = GetMaterialSlotOverride(matSlot.m_stableId);
+            if (!texture)
+            {
+                texture = &StoreMaterialTexture(matSlot.m_defaultMaterialAsset);
+            }
+
+            if (AddRglEntity(mesh, texture))
             {
                 AssignMaterialSlotIdForMesh(matSlot.m_stableId, entityIdx);
-                const Wrappers::RglTexture& texture = modelLibrary->StoreMaterialAsset(matSlot.m_defaultMaterialAsset);
-                if (texture.IsValid())
-                {
-                    entity.SetIntensityTexture(texture);
-                }
-
-                if (m_packedRglEntityId.has_value())
-                {
-                    entity.SetId(m_packedRglEntityId.value());
-                }
-
-                m_entities.emplace_back(AZStd::move(entity));
+                m_entityMeshIndices.push_back(meshIdx);
                 ++entityIdx;
             }
         }
 
         m_isPoseUpdateNeeded = true;
-
-        // We can use material info only when the model is ready.
-        AZ::Render::MaterialComponentNotificationBus::Handler::BusConnect(m_entityId);
-    }
-
-    void MeshEntityManager::OnModelPreDestroy()
-    {
-        AZ::Render::MaterialComponentNotificationBus::Handler::BusDisconnect();
-        ResetMaterialsMapping();
-        m_entities.clear();
     }
 } // namespace RGL
@@ -32,6 +32,10 @@ namespace RGL
         MeshEntityManager& operator=(const MeshEntityManager&) = delete;
         ~MeshEntityManager();
 
+        void Update() override;
+        [[nodiscard]] bool IsBatchable() const override;
+        void AppendBatchGeometry(const Wrappers::RglTexture* intensityTexture, BatchGeometry& geometry) const override;
+
     protected:
         // AZ::EntityBus::Handler implementation overrides
         void OnEntityActivated(const AZ::EntityId& entityId) override;
@@ -42,5 +46,19 @@ namespace RGL
             const AZ::Data::Asset<AZ::RPI::ModelAsset>& modelAsset,
             [[maybe_unused]] const AZ::Data::Instance<AZ::RPI::Model>& model) override;
         void OnModelPreDestroy() override;
+
+    private:
+        //! Selects the LOD of the model based on the last lidar observation.
+        //! Coarser LODs are selected only after the entity moves away by the hysteresis defined in the scene configuration.
+        [[nodiscard]] size_t SelectLod() const;
+        //! Returns the coarsest LOD providing the required number of triangles per expected lidar hit.
+        [[nodiscard]] size_t FindCoarsestSufficientLod(float expectedHitCount, float trianglesPerHit) const;
+        //! Replaces RGL entities of this manager with the ones created from the provided LOD of the model.
+        void CreateLodEntities(size_t lodIndex);
+
+        AZ::Data::Asset<AZ::RPI::ModelAsset> m_modelAsset;
+        AZStd::vector<size_t> m_lodTriangleCounts; //!< Number of triangles in each LOD of the model.
+        AZStd::vector<size_t> m_entityMeshIndices; //!< Index of the model LOD mesh each RGL entity was created from.
+        size_t m_currentLod{ 0U };
     };
 } // namespace RGL
\ No newline at end of file
@@ -0,0 +1,365 @@
+/* Copyright 2024, Robotec.ai sp. z o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/hash.h>
+#include <AzCore/std/math.h>
+#include <Entity/StaticBatcher.h>
+#include <Utilities/RGLUtils.h>
+#include <Wrappers/RglTexture.h>
+
+namespace RGL
+{
+    bool StaticBatcher::BatchKey::operator==(const BatchKey& other) const
+    {
+        return m_regionX == other.m_regionX && m_regionY == other.m_regionY && m_intensityTexture == other.m_intensityTexture &&
+            m_classId == other.m_classId;
+    }
+
+    size_t StaticBatcher::BatchKeyHasher::operator()(const BatchKey& key) const
+    {
+        size_t seed = 0U;
+        AZStd::hash_combine(seed, key.m_regionX);
+        AZStd::hash_combine(seed, key.m_regionY);
+        AZStd::hash_combine(seed, key.m_intensityTexture);
+        AZStd::hash_combine(seed, key.m_classId);
+        return seed;
+    }
+
+    StaticBatcher::~StaticBatcher()
+    {
+        ModelLibraryNotificationBus::MultiHandler::BusDisconnect();
+    }
+
+    void StaticBatcher::Update(const StaticBatchingConfiguration& config, EntityManagerMap& entityManagers, float deltaTime)
+    {
+        if (!config.m_isEnabled)
+        {
+            if (!m_entityStates.empty())
+            {
+                Clear(entityManagers);
+            }
+            return;
+        }
+
+        for (auto& [entityId, entityManager] : entityManagers)
+        {
+            auto stateIt = m_entityStates.find(entityId);
+            const bool isInBatches = stateIt != m_entityStates.end() && !stateIt->second.m_batchKeys.empty();
+            if (!isInBatches && !entityManager->IsBatchable())
+            {
+                continue;
+            }
+
+            EntityState& state = stateIt != m_entityStates.end() ? stateIt->second : m_entityStates[entityId];
+            const bool hasChanged = entityManager->GetTransformChangeCount() != state.m_transformChangeCount ||
+                entityManager->GetGeometryChangeCount() != state.m_geometryChangeCount;
+            const bool hasIntensityChanged = entityManager->GetIntensityChangeCount() != state.m_intensityChangeCount;
+            state.m_transformChangeCount = entityManager->GetTransformChangeCount();
+            state.m_geometryChangeCount = entityManager->GetGeometryChangeCount();
+            state.m_intensityChangeCount = entityManager->GetIntensityChangeCount();
+
+            if (!hasChanged && hasIntensityChanged && isInBatches && !AreBatchTexturesCurrent(*entityManager, state))
+            {
+                // Batches are grouped by texture, so the entity is moved to the batches of its new textures.
+                // Its static time is kept and it uses its own RGL entities until the new batches are rebuilt.
+                RemoveFromBatches(state, entityId);
+                entityManager->SetIsBatched(false);
+                AddToBatches(*entityManager, state, config.m_regionSize);
+                continue;
+            }
+
+            if (!hasChanged && !entityManager->IsResident() && isInBatches)
+            {
+                // Entities close to the streaming range may flip their residency often. Their geometry is kept in the batches
+                // for a while, so that the batches are not rebuilt on each flip.
+                state.m_nonResidentTime += deltaTime;
+                if (state.m_nonResidentTime < config.m_nonResidentTime)
+                {
+                    continue;
+                }
+            }
+
+            state.m_nonResidentTime = 0.0f;
+            if (hasChanged || !entityManager->IsResident())
+            {
+                state.m_staticTime = 0.0f;
+                if (isInBatches)
+                {
+                    RemoveFromBatches(state, entityId);
+                    entityManager->SetIsBatched(false);
+                }
+                continue;
+            }
+
+            state.m_staticTime += deltaTime;
+            if (!isInBatches && (entityManager->IsTransformStatic() || state.m_staticTime >= config.m_staticTime))
+            {
+                // The entity keeps its own RGL entities until all batches containing it are rebuilt.
+                AddToBatches(*entityManager, state, config.m_regionSize);
+            }
+        }
+
+        // Batches which lost members are always rebuilt, so that the geometry of the removed entities does not remain in the scene.
+        // Other rebuilds only take over geometry still present through the entities themselves, so they are limited
+        // and the remaining batches are rebuilt in the following updates.
+        AZ::u32 rebuildCount = 0U;
+        for (auto batchIt = m_batches.begin(); batchIt != m_batches.end();)
+        {
+            Batch& batch = batchIt->second;
+            if (batch.m_members.empty())
+            {
+                batchIt = m_batches.erase(batchIt);
+                continue;
+            }
+
+            const bool isRebuildAllowed =
+                batch.m_hasRemovedMembers || config.m_maxRebuildsPerTick == 0U || rebuildCount < config.m_maxRebuildsPerTick;
+            if (batch.m_isDirty && isRebuildAllowed)
+            {
+                RebuildBatch(batch, entityManagers);
+                m_rebuiltMembers.insert(m_rebuiltMembers.end(), batch.m_members.begin(), batch.m_members.end());
+                ++rebuildCount;
+            }
+            ++batchIt;
+        }
+
+        // Entities whose geometry is present in all of their batches no longer need their own RGL entities.
+        for (const AZ::EntityId& entityId : m_rebuiltMembers)
+        {
+            const auto managerIt = entityManagers.find(entityId);
+            if (managerIt == entityManagers.end() || managerIt->second->IsBatched())
+            {
+                continue;
+            }
+
+            const EntityState& state = m_entityStates[entityId];
+            const bool areBatchesRebuilt = AZStd::all_of(
+                state.m_batchKeys.begin(),
+                state.m_batchKeys.end(),
+                [this](const BatchKey& key)
+                {
+                    const auto batchIt = m_batches.find(key);
+                    return batchIt == m_batches.end() || !batchIt->second.m_isDirty;
+                });
+            if (areBatchesRebuilt)
+            {
+                managerIt->second->SetIsBatched(true);
+            }
+        }
+        m_rebuiltMembers.clear();
+    }
+
+    void StaticBatcher::Remove(AZ::EntityId entityId)
+    {
+        if (auto stateIt = m_entityStates.find(entityId); stateIt != m_entityStates.end())
+        {
+            RemoveFromBatches(stateIt->second, entityId);
+            m_entityStates.erase(stateIt);
+        }
+    }
+
+    void StaticBatcher::Clear(EntityManagerMap& entityManagers)
+    {
+        for (const auto& [entityId, state] : m_entityStates)
+        {
+            if (auto managerIt = entityManagers.find(entityId); managerIt != entityManagers.end())
+            {
+                managerIt->second->SetIsBatched(false);
+            }
+        }
+
+        Clear();
+    }
+
+    void StaticBatcher::Clear()
+    {
+        ModelLibraryNotificationBus::MultiHandler::BusDisconnect();
+        m_batches.clear();
+        m_entityStates.clear();
+    }
+
+    void StaticBatcher::CollectMemoryUsage(MemoryUsageReport& report) const
+    {
+        if (m_batches.empty())
+        {
+            return;
+        }
+
+        MemoryUsage& batchesUsage = report.m_other["Static batches"];
+        for (const auto& [key, batch] : m_batches)
+        {
+            batchesUsage += batch.m_mesh.GetMemoryUsage();
+        }
+    }
+
+    void StaticBatcher::AddToBatches(EntityManager& entityManager, EntityState& state, float regionSize)
+    {
+        m_textures.clear();
+        entityManager.CollectIntensityTextures(m_textures);
+
+        const AZ::Vector3 position = entityManager.GetWorldTranslation();
+        const AZStd::optional<int32_t>& packedRglEntityId = entityManager.GetPackedRglEntityId();
+        const uint8_t classId = packedRglEntityId.has_value() ? Utils::UnpackRglEntityId(packedRglEntityId.value()).m_classId : 0U;
+
+        for (const Wrappers::RglTexture* texture : m_textures)
+        {
+            const BatchKey key{
+                static_cast<int32_t>(AZStd::floor(position.GetX() / regionSize)),
+                static_cast<int32_t>(AZStd::floor(position.GetY() / regionSize)),
+                texture,
+                classId,
+            };
+
+            Batch& batch = m_batches[key];
+            if (batch.m_members.empty() && !batch.m_entity.IsValid())
+            {
+                // All entities of a batch share a single segmentation entity ID.
+                batch.m_packedRglEntityId =
+                    Utils::PackRglEntityId(ROS2Sensors::SegmentationIds{ Utils::GenerateSegmentationEntityId(), classId });
+                batch.m_intensityTexture = texture;
+
+                if (ModelLibraryRequests* modelLibrary = ModelLibraryInterface::Get();
+                    texture && modelLibrary && modelLibrary->IsPlaceholderTexture(*texture))
+                {
+                    ModelLibraryNotificationBus::MultiHandler::BusConnect(texture);
+                }
+            }
+
+            batch.m_members.push_back(entityManager.GetEntityId());
+            batch.m_isDirty = true;
+            state.m_batchKeys.push_back(key);
+        }
+    }
+
+    void StaticBatcher::RemoveFromBatches(EntityState& state, AZ::EntityId entityId)
+    {
+        for (const BatchKey& key : state.m_batchKeys)
+        {
+            auto batchIt = m_batches.find(key);
+            if (batchIt == m_batches.end())
+            {
+                continue;
+            }
+
+            auto& members = batchIt->second.m_members;
+            if (auto memberIt = AZStd::find(members.begin(), members.end(), entityId); memberIt != members.end())
+            {
+                *memberIt = members.back();
+                members.pop_back();
+            }
+            batchIt->second.m_isDirty = true;
+            batchIt->second.m_hasRemovedMembers = true;
+        }
+
+        state.m_batchKeys.clear();
+    }
+
+    bool StaticBatcher::AreBatchTexturesCurrent(const EntityManager& entityManager, const EntityState& state)
+    {
+        m_textures.clear();
+        entityManager.CollectIntensityTextures(m_textures);
+        if (m_textures.size() != state.m_batchKeys.size())
+        {
+            return false;
+        }
+
+        return AZStd::all_of(
+            state.m_batchKeys.begin(),
+            state.m_batchKeys.end(),
+            [this](const BatchKey& key)
+            {
+                const auto batchIt = m_batches.find(key);
+                return batchIt != m_batches.end() &&
+                    AZStd::find(m_textures.begin(), m_textures.end(), batchIt->second.m_intensityTexture) != m_textures.end();
+            });
+    }
+
+    void StaticBatcher::RebuildBatch(Batch& batch, const EntityManagerMap& entityManagers)
+    {
+        batch.m_isDirty = false;
+        batch.m_hasRemovedMembers = false;
+
+        // The entity has to be destroyed before its mesh.
+        batch.m_entity = Wrappers::RglEntity::CreateInvalid();
+        batch.m_mesh = Wrappers::RglMesh::CreateInvalid();
+
+        m_geometry.m_vertices.clear();
+        m_geometry.m_indices.clear();
+        m_geometry.m_uvs.clear();
+        for (const AZ::EntityId& memberId : batch.m_members)
+        {
+            if (auto managerIt = entityManagers.find(memberId); managerIt != entityManagers.end())
+            {
+                managerIt->second->AppendBatchGeometry(batch.m_intensityTexture, m_geometry);
+            }
+        }
+
+        if (m_geometry.m_indices.empty())
+        {
+            return;
+        }
+
+        batch.m_mesh = Wrappers::RglMesh(
+            m_geometry.m_vertices.data(), m_geometry.m_vertices.size(), m_geometry.m_indices.data(), m_geometry.m_indices.size());
+        if (!batch.m_mesh.IsValid())
+        {
+            AZ_Error(
+                __func__,
+                false,
+                "Failed to create a static batch mesh. Geometry of %zu entities will not be present.",
+                batch.m_members.size());
+            return;
+        }
+
+        if (m_geometry.m_uvs.size() == m_geometry.m_vertices.size())
+        {
+            batch.m_mesh.SetTextureCoordinates(m_geometry.m_uvs.data(), m_geometry.m_uvs.size());
+        }
+
+        batch.m_entity = Wrappers::RglEntity(batch.m_mesh);
+        if (!batch.m_entity.IsValid())
+        {
+            return;
+        }
+
+        batch.m_entity.SetTransform(Utils::IdentityTransform);
+        batch.m_entity.SetId(batch.m_packedRglEntityId);
+        if (batch.m_intensityTexture && batch.m_intensityTexture->IsValid())
+        {
+            batch.m_entity.SetIntensityTexture(*batch.m_intensityTexture);
+        }
+    }
+
+    void StaticBatcher::OnMaterialTextureReady(const Wrappers::RglTexture& placeholder, const Wrappers::RglTexture& texture)
+    {
+        // The members replace the placeholder as well, so the batch geometry stays valid and is not rebuilt.
+        for (auto& [key, batch] : m_batches)
+        {
+            if (batch.m_intensityTexture != &placeholder)
+            {
+                continue;
+            }
+
+            batch.m_intensityTexture = &texture;
+            if (batch.m_entity.IsValid() && texture.IsValid())
+            {
+                batch.m_entity.SetIntensityTexture(texture);
+            }
+        }
+
+        // Each placeholder is replaced only once.
+        ModelLibraryNotificationBus::MultiHandler::BusDisconnect(&placeholder);
+    }
+} // namespace RGL
@@ -0,0 +1,116 @@
+/* Copyright 2024, Robotec.ai sp. z o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <AzCore/Component/EntityId.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <Entity/EntityManager.h>
+#include <Model/ModelLibraryBus.h>
+#include <RGL/MemoryUsageBus.h>
+#include <RGL/SceneConfiguration.h>
+#include <Wrappers/RglEntity.h>
+#include <Wrappers/RglMesh.h>
+
+namespace RGL
+{
+    //! Merges the geometry of static entities into combined RGL meshes with baked transforms.
+    //! Entities are grouped by region, intensity texture and segmentation class,
+    //! which reduces the number of RGL entities (instances) in the scene.
+    //! Batched entities are split back out of their batches once they move or change their geometry,
+    //! or once they remain non-resident for a while.
+    //! Replacing a placeholder intensity texture only updates the texture of the batches, without splitting their members.
+    class StaticBatcher : protected ModelLibraryNotificationBus::MultiHandler
+    {
+    public:
+        using EntityManagerMap = AZStd::unordered_map<AZ::EntityId, AZStd::unique_ptr<EntityManager>>;
+
+        StaticBatcher() = default;
+        StaticBatcher(const StaticBatcher& other) = delete;
+        ~StaticBatcher();
+
+        //! Batches entities which remained static long enough, splits moved entities and rebuilds the affected batches.
+        //! Batches which lost members are rebuilt right away. Other rebuilds are limited per call, so newly batched entities
+        //! may keep their own RGL entities for a few ticks, until all batches containing them are rebuilt.
+        void Update(const StaticBatchingConfiguration& config, EntityManagerMap& entityManagers, float deltaTime);
+        //! Removes the entity from its batches. Its manager is expected to be destroyed.
+        void Remove(AZ::EntityId entityId);
+        //! Splits all entities out of their batches and destroys the batches.
+        void Clear(EntityManagerMap& entityManagers);
+        //! Destroys all batches. Managers of the batched entities are expected to be destroyed.
+        void Clear();
+
+        void CollectMemoryUsage(MemoryUsageReport& report) const;
+
+        StaticBatcher& operator=(const StaticBatcher& other) = delete;
+
+    protected:
+        // ModelLibraryNotificationBus overrides
+        void OnMaterialTextureReady(const Wrappers::RglTexture& placeholder, const Wrappers::RglTexture& texture) override;
+
+    private:
+        struct BatchKey
+        {
+            int32_t m_regionX{ 0 };
+            int32_t m_regionY{ 0 };
+            const Wrappers::RglTexture* m_intensityTexture{ nullptr };
+            uint8_t m_classId{ 0U };
+
+            bool operator==(const BatchKey& other) const;
+        };
+
+        struct BatchKeyHasher
+        {
+            size_t operator()(const BatchKey& key) const;
+        };
+
+        struct Batch
+        {
+            AZStd::vector<AZ::EntityId> m_members;
+            Wrappers::RglMesh m_mesh{ Wrappers::RglMesh::CreateInvalid() };
+            Wrappers::RglEntity m_entity{ Wrappers::RglEntity::CreateInvalid() };
+            //! Texture of the batch. Differs from the key texture once the key texture (a placeholder) is replaced.
+            const Wrappers::RglTexture* m_intensityTexture{ nullptr };
+            int32_t m_packedRglEntityId{ 0 };
+            bool m_isDirty{ false };
+            bool m_hasRemovedMembers{ false }; //!< The batch mesh may contain geometry of entities which are no longer members.
+        };
+
+        struct EntityState
+        {
+            float m_staticTime{ 0.0f };
+            float m_nonResidentTime{ 0.0f }; //!< Time the entity has been non-resident while batched.
+            AZ::u32 m_transformChangeCount{ 0U };
+            AZ::u32 m_geometryChangeCount{ 0U };
+            AZ::u32 m_intensityChangeCount{ 0U };
+            //! Batches containing the entity. Empty if not batched.
+            //! The manager is marked as batched only once all of these batches are rebuilt with its geometry.
+            AZStd::vector<BatchKey> m_batchKeys;
+        };
+
+        void AddToBatches(EntityManager& entityManager, EntityState& state, float regionSize);
+        void RemoveFromBatches(EntityState& state, AZ::EntityId entityId);
+        //! Returns true if the entity uses exactly the textures of the batches containing it.
+        bool AreBatchTexturesCurrent(const EntityManager& entityManager, const EntityState& state);
+        void RebuildBatch(Batch& batch, const EntityManagerMap& entityManagers);
+
+        AZStd::unordered_map<AZ::EntityId, EntityState> m_entityStates;
+        AZStd::unordered_map<BatchKey, Batch, BatchKeyHasher> m_batches;
+        BatchGeometry m_geometry; //!< Cached to avoid reallocation on each batch rebuild.
+        AZStd::vector<const Wrappers::RglTexture*> m_textures; //!< Cached to avoid reallocation on each update.
+        AZStd::vector<AZ::EntityId> m_rebuiltMembers; //!< Cached to avoid reallocation on each update.
+    };
+} // namespace RGL
@@ -12,6 +12,11 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/parallel/thread.h>
 #include <AzFramework/Physics/HeightfieldProviderBus.h>
 #include <AzFramework/Terrain/TerrainDataRequestBus.h>
 #include <Entity/Terrain/TerrainData.h>
@@ -19,6 +24,77 @@
 
 namespace RGL
 {
+    namespace
+    {
+        //! Number of grid sectors along each side of a tile.
+        constexpr AZ::s64 TileSectorCount = 128;
+        //! Tiles share the vertices on their borders, so they have one more row of vertices than of sectors.
+        constexpr size_t MaxTileRowCount = static_cast<size_t>(TileSectorCount) + 1U;
+        //! Tolerance (in grid spacing units) for vertices lying on the boundary of the dirty region.
+        constexpr float GridBoundaryTolerance = 1.0e-3f;
+
+        //! Division rounding towards negative infinity, since grid indices may be negative.
+        AZ::s64 FloorDivide(AZ::s64 value, AZ::s64 divisor)
+        {
+            return value >= 0 ? value / divisor : -((divisor - 1 - value) / divisor);
+        }
+
+        //! Returns the range [begin, end) of grid indices whose coordinates (in grid spacing units) lie within [min, max].
+        //! The range is clamped to [indexBegin, indexEnd).
+        AZStd::pair<AZ::s64, AZ::s64> GetGridIndexRange(float min, float max, AZ::s64 indexBegin, AZ::s64 indexEnd)
+        {
+            const float begin = AZStd::max(AZStd::ceil(min - GridBoundaryTolerance), aznumeric_cast<float>(indexBegin));
+            const float end = AZStd::min(AZStd::floor(max + GridBoundaryTolerance) + 1.0f, aznumeric_cast<float>(indexEnd));
+            if (begin >= end)
+            {
+                return { indexBegin, indexBegin };
+            }
+
+            return { aznumeric_cast<AZ::s64>(begin), aznumeric_cast<AZ::s64>(end) };
+        }
+
+        TerrainData::TileKey GetTileKey(AZ::s64 tileX, AZ::s64 tileY)
+        {
+            return (aznumeric_cast<AZ::u64>(static_cast<AZ::u32>(tileX)) << 32U) | static_cast<AZ::u32>(tileY);
+        }
+    } // namespace
+
+    TerrainData::~TerrainData()
+    {
+        Clear();
+    }
+
+    AZ::u8 TerrainData::SurfaceIntensityTable::GetIntensity(const AzFramework::SurfaceData::SurfaceTagWeightList& surfaceTags) const
+    {
+        AZ::u8 intensity = m_defaultIntensity;
+        float maxWeight = -1.0f;
+        for (const AzFramework::SurfaceData::SurfaceTagWeight& tagWeight : surfaceTags)
+        {
+            if (tagWeight.m_weight <= maxWeight)
+            {
+                continue;
+            }
+
+            // The table is small, so it is searched linearly.
+            for (const auto& [surfaceTag, tagIntensity] : m_intensities)
+            {
+                if (surfaceTag == tagWeight.m_surfaceType)
+                {
+                    intensity = tagIntensity;
+                    maxWeight = tagWeight.m_weight;
+                    break;
+                }
+            }
+        }
+
+        return intensity;
+    }
+
+    bool TerrainData::SurfaceIntensityTable::operator==(const SurfaceIntensityTable& other) const
+    {
+        return m_isEnabled == other.m_isEnabled && m_defaultIntensity == other.m_defaultIntensity && m_intensities == other.m_intensities;
+    }
+
     bool TerrainData::UpdateBounds(const AZ::Aabb& newWorldBounds)
     {
         if (newWorldBounds == m_currentWorldBounds)
@@ -42,147 +118,953 @@ namespace RGL
         Physics::HeightfieldProviderRequestsBus::BroadcastResult(
             heightfieldGridSpacing, &Physics::HeightfieldProviderRequests::GetHeightfieldGridSpacing);
 
-        m_gridColumns = heightfieldGridColumns;
-        m_gridRows = heightfieldGridRows;
+        const AZ::Vector2 constrictedAlignedStartIndex = (AZ::Vector2(newWorldBounds.GetMin()) / heightfieldGridSpacing).GetCeil();
+        Grid grid;
+        grid.m_firstColumn = aznumeric_cast<AZ::s64>(constrictedAlignedStartIndex.GetX());
+        grid.m_firstRow = aznumeric_cast<AZ::s64>(constrictedAlignedStartIndex.GetY());
+        grid.m_columnCount = heightfieldGridColumns;
+        grid.m_rowCount = heightfieldGridRows;
+        grid.m_spacing = heightfieldGridSpacing;
+
+        // Without tiling, the UVs of all vertices depend on the grid extents.
+        const bool isGridChanged = grid.m_columnCount != m_grid.m_columnCount || grid.m_rowCount != m_grid.m_rowCount ||
+            grid.m_firstColumn != m_grid.m_firstColumn || grid.m_firstRow != m_grid.m_firstRow;
+        if (!grid.m_spacing.IsClose(m_grid.m_spacing, 0.0f) || (m_settings.m_uvMapping == UvMapping::Stretched && isGridChanged))
+        {
+            m_tiles.clear();
+        }
 
+        // Tiles being built in the background use the previous grid.
+        DropTileBuilds();
 
         m_currentWorldBounds = newWorldBounds;
+        m_grid = grid;
+
+        const AZ::s64 gridEndColumn = m_grid.m_firstColumn + aznumeric_cast<AZ::s64>(m_grid.m_columnCount);
+        const AZ::s64 gridEndRow = m_grid.m_firstRow + aznumeric_cast<AZ::s64>(m_grid.m_rowCount);
+        m_tileXBegin = FloorDivide(m_grid.m_firstColumn, TileSectorCount);
+        m_tileXEnd = FloorDivide(gridEndColumn - 2, TileSectorCount) + 1;
+        m_tileYBegin = FloorDivide(m_grid.m_firstRow, TileSectorCount);
+        m_tileYEnd = FloorDivide(gridEndRow - 2, TileSectorCount) + 1;
+
+        // Tiles covering the same part of the grid as before are kept, so only the tiles on the changed edges are created.
+        // The heights of the resized edge tiles are reused where they overlap the previous tiles.
+        TileMap tiles;
+        TileMap resizedTiles;
+        for (AZ::s64 tileX = m_tileXBegin; tileX < m_tileXEnd; ++tileX)
+        {
+            for (AZ::s64 tileY = m_tileYBegin; tileY < m_tileYEnd; ++tileY)
+            {
+                const TileKey key = GetTileKey(tileX, tileY);
+                auto tileIt = m_tiles.find(key);
+                if (tileIt == m_tiles.end())
+                {
+                    continue;
+                }
 
-        m_vertices.clear();
+                const Tile& oldTile = tileIt->second;
+                const Tile tile = CreateTileExtents(tileX, tileY);
+                if (oldTile.m_firstColumn == tile.m_firstColumn && oldTile.m_firstRow == tile.m_firstRow &&
+                    oldTile.m_columnCount == tile.m_columnCount && oldTile.m_rowCount == tile.m_rowCount)
+                {
+                    tiles.emplace(key, AZStd::move(tileIt->second));
+                }
+                else
+                {
+                    resizedTiles.emplace(key, AZStd::move(tileIt->second));
+                }
+            }
+        }
 
-        const size_t vertexCount = m_gridColumns * m_gridRows;
-        m_vertices.reserve(vertexCount);
+        AZStd::swap(m_tiles, tiles);
 
-        const AZ::Vector3 worldMin = newWorldBounds.GetMin();
-        const AZ::Vector2 constrictedAlignedStartPoint = (AZ::Vector2(worldMin) / heightfieldGridSpacing).GetCeil() * heightfieldGridSpacing;
+        // With streaming enabled, the missing tiles are built once they get within the range of a lidar.
+        if (!m_isStreamingEnabled)
+        {
+            BuildMissingTiles(&resizedTiles);
+        }
+
+        return true;
+    }
+
+    void TerrainData::UpdateDirtyRegion(const AZ::Aabb& dirtyRegion, AZStd::vector<TileKey>& updatedTiles)
+    {
+        updatedTiles.clear();
+        if (m_tiles.empty() && m_tileBuilds.empty())
+        {
+            return;
+        }
+
+        // The dirty region is mapped to the ranges of grid columns (x axis) and rows (y axis) it contains.
+        const AZ::Vector2 regionMin = AZ::Vector2(dirtyRegion.GetMin()) / m_grid.m_spacing;
+        const AZ::Vector2 regionMax = AZ::Vector2(dirtyRegion.GetMax()) / m_grid.m_spacing;
+        const auto [columnBegin, columnEnd] = GetGridIndexRange(
+            regionMin.GetX(), regionMax.GetX(), m_grid.m_firstColumn, m_grid.m_firstColumn + aznumeric_cast<AZ::s64>(m_grid.m_columnCount));
+        const auto [rowBegin, rowEnd] = GetGridIndexRange(
+            regionMin.GetY(), regionMax.GetY(), m_grid.m_firstRow, m_grid.m_firstRow + aznumeric_cast<AZ::s64>(m_grid.m_rowCount));
+        if (columnBegin == columnEnd || rowBegin == rowEnd)
+        {
+            return;
+        }
 
-        for (size_t vertexIndexX = 0LU; vertexIndexX < m_gridColumns; ++vertexIndexX)
+        // Ranges of tile columns and rows within the dirty region.
+        struct TileUpdate
         {
-            for (size_t vertexIndexY = 0LU; vertexIndexY < m_gridRows; ++vertexIndexY)
+            Tile* m_tile;
+            size_t m_columnBegin, m_columnEnd, m_rowBegin, m_rowEnd;
+            VertexDataChanges m_changes;
+            bool m_areTrianglesChanged{ false };
+        };
+
+        // Tiles ending at the first dirty column (or row) share it with the next tile, so they are checked as well.
+        AZStd::vector<TileUpdate> tileUpdates;
+        for (AZ::s64 tileX = FloorDivide(columnBegin - 1, TileSectorCount); tileX <= FloorDivide(columnEnd - 1, TileSectorCount); ++tileX)
+        {
+            for (AZ::s64 tileY = FloorDivide(rowBegin - 1, TileSectorCount); tileY <= FloorDivide(rowEnd - 1, TileSectorCount); ++tileY)
             {
-                m_vertices.emplace_back(rgl_vec3f{
-                    constrictedAlignedStartPoint.GetX() + aznumeric_cast<float>(vertexIndexX) * heightfieldGridSpacing.GetX(),
-                    constrictedAlignedStartPoint.GetY() + aznumeric_cast<float>(vertexIndexY) * heightfieldGridSpacing.GetY(),
-                    0.0f,
-                });
+                const TileKey key = GetTileKey(tileX, tileY);
+                // Tiles being built may have fetched the previous heights, so they are built again later.
+                if (auto buildIt = m_tileBuilds.find(key); buildIt != m_tileBuilds.end())
+                {
+                    m_droppedTileBuilds.push_back(AZStd::move(buildIt->second));
+                    m_tileBuilds.erase(buildIt);
+                }
+
+                auto tileIt = m_tiles.find(key);
+                if (tileIt == m_tiles.end())
+                {
+                    continue;
+                }
+
+                Tile& tile = tileIt->second;
+                const AZ::s64 tileColumnBegin = AZStd::max(columnBegin, tile.m_firstColumn) - tile.m_firstColumn;
+                const AZ::s64 tileColumnEnd = AZStd::min(columnEnd - tile.m_firstColumn, aznumeric_cast<AZ::s64>(tile.m_columnCount));
+                const AZ::s64 tileRowBegin = AZStd::max(rowBegin, tile.m_firstRow) - tile.m_firstRow;
+                const AZ::s64 tileRowEnd = AZStd::min(rowEnd - tile.m_firstRow, aznumeric_cast<AZ::s64>(tile.m_rowCount));
+                if (tileColumnBegin >= tileColumnEnd || tileRowBegin >= tileRowEnd)
+                {
+                    continue;
+                }
+
+                tileUpdates.push_back({ &tile,
+                                        aznumeric_cast<size_t>(tileColumnBegin),
+                                        aznumeric_cast<size_t>(tileColumnEnd),
+                                        aznumeric_cast<size_t>(tileRowBegin),
+                                        aznumeric_cast<size_t>(tileRowEnd) });
+                updatedTiles.push_back(key);
             }
         }
 
-        UpdateUvs();
+        // Each job queries the heights of whole tiles at once. Tiles store separate copies of their border vertices.
+        Utils::ParallelFor(
+            tileUpdates.size(),
+            1U,
+            [this, &tileUpdates](size_t begin, size_t end)
+            {
+                for (size_t updateIdx = begin; updateIdx < end; ++updateIdx)
+                {
+                    TileUpdate& update = tileUpdates[updateIdx];
+                    update.m_changes = QueryVertexData(
+                        m_grid,
+                        m_settings.m_surfaceIntensities,
+                        *update.m_tile,
+                        update.m_columnBegin,
+                        update.m_columnEnd,
+                        update.m_rowBegin,
+                        update.m_rowEnd);
+                    if (update.m_changes.m_areHolesChanged || m_settings.m_meshConfig.m_isAdaptive)
+                    {
+                        TriangulateTile(m_settings.m_meshConfig, *update.m_tile);
+                        update.m_areTrianglesChanged = true;
+                    }
+                }
+            });
 
-        m_indices.clear();
-        m_indices.reserve((m_gridColumns - 1) * (m_gridRows - 1) * TrianglesPerSector);
-        for (size_t sectorIndexX = 0LU; sectorIndexX < m_gridColumns - 1; ++sectorIndexX)
+        // Tiles with changed holes (or adaptively triangulated tiles) have different triangles, so their meshes have to be recreated.
+        for (const TileUpdate& update : tileUpdates)
         {
-            for (size_t sectorIndexY = 0LU; sectorIndexY < m_gridRows - 1; ++sectorIndexY)
+            if (update.m_areTrianglesChanged)
             {
-                const auto lowerLeft = aznumeric_cast<int32_t>(sectorIndexY + sectorIndexX * m_gridRows);
-                const auto lowerRight = aznumeric_cast<int32_t>(lowerLeft + m_gridRows);
-                const auto upperLeft = aznumeric_cast<int32_t>(lowerLeft + 1);
-                const auto upperRight = aznumeric_cast<int32_t>(lowerRight + 1);
+                update.m_tile->m_revision = ++m_tileRevision;
+            }
 
-                m_indices.emplace_back(rgl_vec3i{ upperLeft, lowerRight, upperRight });
-                m_indices.emplace_back(rgl_vec3i{ upperLeft, lowerLeft, lowerRight });
+            if (update.m_changes.m_areIntensitiesChanged)
+            {
+                update.m_tile->m_intensityRevision = ++m_tileRevision;
             }
         }
-
-        return true;
     }
 
-    void TerrainData::UpdateDirtyRegion(const AZ::Aabb& dirtyRegion)
+    bool TerrainData::UpdateStreaming(const AZStd::vector<LidarVolume>& lidarVolumes, const GeometryStreamingConfiguration& config)
     {
-        const AZ::Aabb dirtyRegion2D = AZ::Aabb::CreateFromMinMaxValues(
-            dirtyRegion.GetMin().GetX(),
-            dirtyRegion.GetMin().GetY(),
-            AZStd::numeric_limits<float>::lowest(),
-            dirtyRegion.GetMax().GetX(),
-            dirtyRegion.GetMax().GetY(),
-            AZStd::numeric_limits<float>::max());
+        if (m_isStreamingEnabled != config.m_isEnabled)
+        {
+            m_isStreamingEnabled = config.m_isEnabled;
+            if (!m_isStreamingEnabled)
+            {
+                DropTileBuilds();
+                const size_t tileCount = m_tiles.size();
+                BuildMissingTiles(nullptr);
+                return m_tiles.size() != tileCount;
+            }
+        }
+
+        if (!m_isStreamingEnabled || m_grid.m_columnCount < 2U || m_grid.m_rowCount < 2U)
+        {
+            return false;
+        }
+
+        const auto isBuildDone = [](const AZStd::shared_ptr<TileBuild>& tileBuild)
+        {
+            return tileBuild->m_isDone.load(AZStd::memory_order_acquire);
+        };
+        m_droppedTileBuilds.erase(
+            AZStd::remove_if(m_droppedTileBuilds.begin(), m_droppedTileBuilds.end(), isBuildDone), m_droppedTileBuilds.end());
 
-        for (rgl_vec3f& vertex : m_vertices)
+        // Tiles are removed (or their builds dropped) only after exceeding the margin by the hysteresis.
+        const float removalMargin = config.m_margin + config.m_hysteresis;
+        const auto isTileObserved = [this, &lidarVolumes](const Tile& tile, float margin)
         {
-            if (dirtyRegion2D.Contains(Utils::AzVector3FromRglVec3f(vertex)))
+            return AZStd::any_of(
+                lidarVolumes.begin(),
+                lidarVolumes.end(),
+                [this, &tile, margin](const LidarVolume& lidarVolume)
+                {
+                    return GetDistanceToTile(lidarVolume.m_position, tile) <= lidarVolume.m_maxRange + margin;
+                });
+        };
+
+        bool areTilesChanged = false;
+        for (auto tileIt = m_tiles.begin(); tileIt != m_tiles.end();)
+        {
+            if (isTileObserved(tileIt->second, removalMargin))
             {
-                float height = AZStd::numeric_limits<float>::lowest();
-                bool terrainExists = false;
+                ++tileIt;
+                continue;
+            }
 
-                // Sampler::Exact is used because mesh vertices are created directly on grid provided from heightfield.
-                AzFramework::Terrain::TerrainDataRequestBus::BroadcastResult(
-                    height,
-                    &AzFramework::Terrain::TerrainDataRequestBus::Events::GetHeightFromFloats,
-                    vertex.value[0],
-                    vertex.value[1],
-                    AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT,
-                    &terrainExists);
+            tileIt = m_tiles.erase(tileIt);
+            areTilesChanged = true;
+        }
+
+        for (auto buildIt = m_tileBuilds.begin(); buildIt != m_tileBuilds.end();)
+        {
+            TileBuild& tileBuild = *buildIt->second;
+            if (!isTileObserved(tileBuild.m_tile, removalMargin))
+            {
+                m_droppedTileBuilds.push_back(AZStd::move(buildIt->second));
+                buildIt = m_tileBuilds.erase(buildIt);
+                continue;
+            }
 
-                if (height != AZStd::numeric_limits<float>::lowest() && terrainExists)
+            if (!tileBuild.m_isDone.load(AZStd::memory_order_acquire))
+            {
+                ++buildIt;
+                continue;
+            }
+
+            tileBuild.m_tile.m_revision = ++m_tileRevision;
+            m_tiles.emplace(buildIt->first, AZStd::move(tileBuild.m_tile));
+            buildIt = m_tileBuilds.erase(buildIt);
+            areTilesChanged = true;
+        }
+
+        // Tiles within the margin are built in the background, each one by a separate job.
+        for (const LidarVolume& lidarVolume : lidarVolumes)
+        {
+            const float reach = lidarVolume.m_maxRange + config.m_margin;
+            const AZ::Vector2 minIndex = (AZ::Vector2(lidarVolume.m_position) - AZ::Vector2(reach)) / m_grid.m_spacing;
+            const AZ::Vector2 maxIndex = (AZ::Vector2(lidarVolume.m_position) + AZ::Vector2(reach)) / m_grid.m_spacing;
+            const AZ::s64 gridEndColumn = m_grid.m_firstColumn + aznumeric_cast<AZ::s64>(m_grid.m_columnCount);
+            const AZ::s64 gridEndRow = m_grid.m_firstRow + aznumeric_cast<AZ::s64>(m_grid.m_rowCount);
+            const auto [columnBegin, columnEnd] = GetGridIndexRange(minIndex.GetX(), maxIndex.GetX(), m_grid.m_firstColumn, gridEndColumn);
+            const auto [rowBegin, rowEnd] = GetGridIndexRange(minIndex.GetY(), maxIndex.GetY(), m_grid.m_firstRow, gridEndRow);
+            if (columnBegin == columnEnd || rowBegin == rowEnd)
+            {
+                continue;
+            }
+
+            const AZ::s64 tileXBegin = AZStd::max(FloorDivide(columnBegin, TileSectorCount), m_tileXBegin);
+            const AZ::s64 tileXEnd = AZStd::min(FloorDivide(columnEnd - 1, TileSectorCount) + 1, m_tileXEnd);
+            const AZ::s64 tileYBegin = AZStd::max(FloorDivide(rowBegin, TileSectorCount), m_tileYBegin);
+            const AZ::s64 tileYEnd = AZStd::min(FloorDivide(rowEnd - 1, TileSectorCount) + 1, m_tileYEnd);
+            for (AZ::s64 tileX = tileXBegin; tileX < tileXEnd; ++tileX)
+            {
+                for (AZ::s64 tileY = tileYBegin; tileY < tileYEnd; ++tileY)
                 {
-                    vertex.value[2] = height;
+                    const TileKey key = GetTileKey(tileX, tileY);
+                    if (m_tiles.contains(key) || m_tileBuilds.contains(key))
+                    {
+                        continue;
+                    }
+
+                    Tile tile = CreateTileExtents(tileX, tileY);
+                    if (GetDistanceToTile(lidarVolume.m_position, tile) > reach)
+                    {
+                        continue;
+                    }
+
+                    auto tileBuild = AZStd::make_shared<TileBuild>();
+                    tileBuild->m_tile = AZStd::move(tile);
+                    m_tileBuilds.emplace(key, tileBuild);
+
+                    AZ::Job* job = AZ::CreateJobFunction(
+                        [grid = m_grid, settings = m_settings, tileBuild]()
+                        {
+                            BuildTile(grid, settings, tileBuild->m_tile, nullptr);
+                            tileBuild->m_isDone.store(true, AZStd::memory_order_release);
+                        },
+                        true);
+                    job->Start();
                 }
             }
         }
+
+        return areTilesChanged;
     }
 
     void TerrainData::Clear()
     {
+        // Jobs own their results, but they still have to finish before the module containing their code is unloaded.
+        DropTileBuilds();
+        for (const AZStd::shared_ptr<TileBuild>& tileBuild : m_droppedTileBuilds)
+        {
+            while (!tileBuild->m_isDone.load(AZStd::memory_order_acquire))
+            {
+                AZStd::this_thread::yield();
+            }
+        }
+        m_droppedTileBuilds.clear();
+
         m_currentWorldBounds = AZ::Aabb::CreateFromPoint(AZ::Vector3::CreateZero());
-        m_gridColumns = m_gridRows = 0U;
-        m_vertices.clear();
-        m_indices.clear();
-        m_uvs.clear();
+        m_grid = {};
+        m_tileXBegin = m_tileXEnd = m_tileYBegin = m_tileYEnd = 0;
+        m_tiles.clear();
     }
 
-    void TerrainData::SetIsTiled(bool isTiled)
+    void TerrainData::SetIntensityConfiguration(const TerrainIntensityConfiguration& intensityConfig)
     {
-        if (m_isTiled == isTiled)
+        SurfaceIntensityTable surfaceIntensities;
+        surfaceIntensities.m_isEnabled = intensityConfig.m_isSurfaceTagIntensityEnabled;
+        surfaceIntensities.m_defaultIntensity = intensityConfig.m_defaultValue;
+        if (surfaceIntensities.m_isEnabled)
+        {
+            for (const SurfaceTagIntensity& tagIntensity : intensityConfig.m_surfaceTagIntensities)
+            {
+                surfaceIntensities.m_intensities.emplace_back(AZ::Crc32(tagIntensity.m_surfaceTag), tagIntensity.m_intensity);
+            }
+        }
+
+        UvMapping uvMapping = intensityConfig.m_isTiled ? UvMapping::Tiled : UvMapping::Stretched;
+        if (surfaceIntensities.m_isEnabled)
+        {
+            uvMapping = UvMapping::PerTile;
+        }
+
+        const bool isUvMappingChanged = uvMapping != m_settings.m_uvMapping;
+        const bool areIntensitiesChanged = !(surfaceIntensities == m_settings.m_surfaceIntensities);
+        if (!isUvMappingChanged && !areIntensitiesChanged)
         {
             return;
         }
 
-        m_isTiled = isTiled;
-        UpdateUvs();
+        m_settings.m_uvMapping = uvMapping;
+        m_settings.m_surfaceIntensities = AZStd::move(surfaceIntensities);
+        DropTileBuilds();
+
+        // UVs are generated when the tiles are uploaded, so only the revisions of the tiles have to change.
+        AZStd::vector<Tile*> tiles;
+        tiles.reserve(m_tiles.size());
+        for (auto& [key, tile] : m_tiles)
+        {
+            if (isUvMappingChanged)
+            {
+                tile.m_revision = ++m_tileRevision;
+            }
+
+            if (areIntensitiesChanged)
+            {
+                tile.m_intensityRevision = ++m_tileRevision;
+                tiles.push_back(&tile);
+            }
+        }
+
+        Utils::ParallelFor(
+            tiles.size(),
+            1U,
+            [this, &tiles](size_t begin, size_t end)
+            {
+                for (size_t tileIdx = begin; tileIdx < end; ++tileIdx)
+                {
+                    Tile& tile = *tiles[tileIdx];
+                    tile.m_intensities.clear();
+                    if (m_settings.m_surfaceIntensities.m_isEnabled)
+                    {
+                        tile.m_intensities.resize(tile.m_columnCount * tile.m_rowCount, m_settings.m_surfaceIntensities.m_defaultIntensity);
+                        QueryVertexData(m_grid, m_settings.m_surfaceIntensities, tile, 0U, tile.m_columnCount, 0U, tile.m_rowCount);
+                    }
+                }
+            });
     }
 
-    const AZStd::vector<rgl_vec3f>& TerrainData::GetVertices() const
+    void TerrainData::SetMeshConfiguration(const TerrainMeshConfiguration& meshConfig)
     {
-        return m_vertices;
+        const TerrainMeshConfiguration& currentMeshConfig = m_settings.m_meshConfig;
+        const bool isErrorChanged = meshConfig.m_maxVerticalError != currentMeshConfig.m_maxVerticalError;
+        if (meshConfig.m_isAdaptive == currentMeshConfig.m_isAdaptive && (!meshConfig.m_isAdaptive || !isErrorChanged))
+        {
+            return;
+        }
+
+        m_settings.m_meshConfig = meshConfig;
+        DropTileBuilds();
+
+        AZStd::vector<Tile*> tiles;
+        tiles.reserve(m_tiles.size());
+        for (auto& [key, tile] : m_tiles)
+        {
+            tile.m_revision = ++m_tileRevision;
+            tiles.push_back(&tile);
+        }
+
+        Utils::ParallelFor(
+            tiles.size(),
+            1U,
+            [this, &tiles](size_t begin, size_t end)
+            {
+                for (size_t tileIdx = begin; tileIdx < end; ++tileIdx)
+                {
+                    TriangulateTile(m_settings.m_meshConfig, *tiles[tileIdx]);
+                }
+            });
     }
 
-    const AZStd::vector<rgl_vec3i>& TerrainData::GetIndices() const
+    const TerrainData::TileMap& TerrainData::GetTiles() const
     {
-        return m_indices;
+        return m_tiles;
     }
 
-    const AZStd::vector<rgl_vec2f>& TerrainData::GetUvs() const
+    void TerrainData::BuildTile(const Grid& grid, const BuildSettings& settings, Tile& tile, const Tile* previousTile)
     {
-        return m_uvs;
+        // Vertex positions and UVs are not stored, they are generated from the grid when the tile is uploaded.
+        tile.m_heights.assign(tile.m_columnCount * tile.m_rowCount, 0.0f);
+        tile.m_isHole.assign(tile.m_columnCount * tile.m_rowCount, 0U);
+        tile.m_intensities.clear();
+        if (settings.m_surfaceIntensities.m_isEnabled)
+        {
+            tile.m_intensities.resize(tile.m_columnCount * tile.m_rowCount, settings.m_surfaceIntensities.m_defaultIntensity);
+        }
+
+        // Only the data outside the part of the grid covered by the previous tile is fetched.
+        const auto [columnBegin, columnEnd, rowBegin, rowEnd] =
+            previousTile ? CopyOverlappingVertexData(*previousTile, tile) : AZStd::tuple<size_t, size_t, size_t, size_t>{ 0U, 0U, 0U, 0U };
+        const SurfaceIntensityTable& surfaceIntensities = settings.m_surfaceIntensities;
+        if (columnBegin == columnEnd || rowBegin == rowEnd)
+        {
+            QueryVertexData(grid, surfaceIntensities, tile, 0U, tile.m_columnCount, 0U, tile.m_rowCount);
+        }
+        else
+        {
+            QueryVertexData(grid, surfaceIntensities, tile, 0U, columnBegin, 0U, tile.m_rowCount);
+            QueryVertexData(grid, surfaceIntensities, tile, columnEnd, tile.m_columnCount, 0U, tile.m_rowCount);
+            QueryVertexData(grid, surfaceIntensities, tile, columnBegin, columnEnd, 0U, rowBegin);
+            QueryVertexData(grid, surfaceIntensities, tile, columnBegin, columnEnd, rowEnd, tile.m_rowCount);
+        }
+
+        // The adaptive triangulation depends on the heights.
+        TriangulateTile(settings.m_meshConfig, tile);
     }
 
-    void TerrainData::UpdateUvs()
+    AZStd::tuple<size_t, size_t, size_t, size_t> TerrainData::CopyOverlappingVertexData(const Tile& source, Tile& tile)
     {
-        m_uvs.clear();
-        m_uvs.reserve(m_gridColumns * m_gridRows);
+        const auto getEnd = [](AZ::s64 first, size_t count)
+        {
+            return first + aznumeric_cast<AZ::s64>(count);
+        };
 
-        for (size_t x = 0; x < m_gridColumns; ++x)
+        const AZ::s64 firstColumn = AZStd::max(source.m_firstColumn, tile.m_firstColumn);
+        const AZ::s64 firstRow = AZStd::max(source.m_firstRow, tile.m_firstRow);
+        const AZ::s64 endColumn =
+            AZStd::min(getEnd(source.m_firstColumn, source.m_columnCount), getEnd(tile.m_firstColumn, tile.m_columnCount));
+        const AZ::s64 endRow = AZStd::min(getEnd(source.m_firstRow, source.m_rowCount), getEnd(tile.m_firstRow, tile.m_rowCount));
+        if (firstColumn >= endColumn || firstRow >= endRow || source.m_heights.size() != source.m_columnCount * source.m_rowCount ||
+            source.m_isHole.size() != source.m_heights.size() || source.m_intensities.size() != tile.m_intensities.size())
         {
-            for (size_t y = 0; y < m_gridRows; ++y)
+            return { 0U, 0U, 0U, 0U };
+        }
+
+        const auto rowCount = aznumeric_cast<size_t>(endRow - firstRow);
+        const auto sourceRowOffset = aznumeric_cast<size_t>(firstRow - source.m_firstRow);
+        const auto tileRowOffset = aznumeric_cast<size_t>(firstRow - tile.m_firstRow);
+        for (AZ::s64 column = firstColumn; column < endColumn; ++column)
+        {
+            const size_t sourceFirstIdx = aznumeric_cast<size_t>(column - source.m_firstColumn) * source.m_rowCount + sourceRowOffset;
+            const size_t tileFirstIdx = aznumeric_cast<size_t>(column - tile.m_firstColumn) * tile.m_rowCount + tileRowOffset;
+            AZStd::copy(
+                source.m_heights.begin() + sourceFirstIdx,
+                source.m_heights.begin() + sourceFirstIdx + rowCount,
+                tile.m_heights.begin() + tileFirstIdx);
+            AZStd::copy(
+                source.m_isHole.begin() + sourceFirstIdx,
+                source.m_isHole.begin() + sourceFirstIdx + rowCount,
+                tile.m_isHole.begin() + tileFirstIdx);
+            if (!tile.m_intensities.empty())
+            {
+                AZStd::copy(
+                    source.m_intensities.begin() + sourceFirstIdx,
+                    source.m_intensities.begin() + sourceFirstIdx + rowCount,
+                    tile.m_intensities.begin() + tileFirstIdx);
+            }
+        }
+
+        return { aznumeric_cast<size_t>(firstColumn - tile.m_firstColumn),
+                 aznumeric_cast<size_t>(endColumn - tile.m_firstColumn),
+                 aznumeric_cast<size_t>(firstRow - tile.m_firstRow),
+                 aznumeric_cast<size_t>(endRow - tile.m_firstRow) };
+    }
+
+    void TerrainData::TriangulateTile(const TerrainMeshConfiguration& meshConfig, Tile& tile)
+    {
+        if (!meshConfig.m_isAdaptive)
+        {
+            // The regular triangulation is generated on demand, so its indices are not stored.
+            tile.m_indices = {};
+            return;
+        }
+
+        tile.m_indices.clear();
+        AZStd::vector<float> errors;
+        TriangulateAdaptively(meshConfig.m_maxVerticalError, tile, 0U, 0U, tile.m_columnCount - 1, tile.m_rowCount - 1, errors);
+    }
+
+    void TerrainData::GenerateRegularIndices(const Tile& tile, AZStd::vector<rgl_vec3i>& indices)
+    {
+        indices.clear();
+        indices.reserve((tile.m_columnCount - 1) * (tile.m_rowCount - 1) * TrianglesPerSector);
+        for (size_t sectorIndexX = 0LU; sectorIndexX < tile.m_columnCount - 1; ++sectorIndexX)
+        {
+            for (size_t sectorIndexY = 0LU; sectorIndexY < tile.m_rowCount - 1; ++sectorIndexY)
+            {
+                const auto lowerLeft = aznumeric_cast<int32_t>(sectorIndexY + sectorIndexX * tile.m_rowCount);
+                const auto lowerRight = aznumeric_cast<int32_t>(lowerLeft + tile.m_rowCount);
+                const auto upperLeft = aznumeric_cast<int32_t>(lowerLeft + 1);
+                const auto upperRight = aznumeric_cast<int32_t>(lowerRight + 1);
+
+                AddTriangle(tile, rgl_vec3i{ upperLeft, lowerRight, upperRight }, indices);
+                AddTriangle(tile, rgl_vec3i{ upperLeft, lowerLeft, lowerRight }, indices);
+            }
+        }
+    }
+
+    void TerrainData::AddTriangle(const Tile& tile, const rgl_vec3i& triangle, AZStd::vector<rgl_vec3i>& indices)
+    {
+        // Triangles touching a hole are omitted, so that lidars see through the hole (e.g. into caves and tunnels).
+        for (const int32_t vertexIdx : triangle.value)
+        {
+            if (tile.m_isHole[vertexIdx] != 0U)
+            {
+                return;
+            }
+        }
+
+        indices.push_back(triangle);
+    }
+
+    void TerrainData::TriangulateAdaptively(
+        float maxError,
+        Tile& tile,
+        size_t firstColumn,
+        size_t firstRow,
+        size_t columnSectorCount,
+        size_t rowSectorCount,
+        AZStd::vector<float>& errors)
+    {
+        if (columnSectorCount == 0U || rowSectorCount == 0U)
+        {
+            return;
+        }
+
+        // Full tiles form a single block. Tiles on the grid edges are covered with the largest fitting blocks first,
+        // and the remaining strips along their right and top sides are covered recursively with smaller blocks.
+        size_t blockSectorCount = 1U;
+        while (blockSectorCount * 2U <= AZStd::min(columnSectorCount, rowSectorCount))
+        {
+            blockSectorCount *= 2U;
+        }
+
+        const size_t blockColumnCount = columnSectorCount / blockSectorCount;
+        const size_t blockRowCount = rowSectorCount / blockSectorCount;
+        for (size_t blockX = 0U; blockX < blockColumnCount; ++blockX)
+        {
+            for (size_t blockY = 0U; blockY < blockRowCount; ++blockY)
             {
-                auto uv = rgl_vec2f{
-                    aznumeric_cast<float>(x),
-                    aznumeric_cast<float>(y),
-                };
+                TriangulateBlock(
+                    maxError,
+                    tile,
+                    firstColumn + blockX * blockSectorCount,
+                    firstRow + blockY * blockSectorCount,
+                    blockSectorCount,
+                    errors);
+            }
+        }
+
+        const size_t coveredColumnSectors = blockColumnCount * blockSectorCount;
+        const size_t coveredRowSectors = blockRowCount * blockSectorCount;
+        TriangulateAdaptively(
+            maxError, tile, firstColumn + coveredColumnSectors, firstRow, columnSectorCount - coveredColumnSectors, rowSectorCount, errors);
+        TriangulateAdaptively(
+            maxError, tile, firstColumn, firstRow + coveredRowSectors, coveredColumnSectors, rowSectorCount - coveredRowSectors, errors);
+    }
 
-                // Terrain Macro Material's image
-                // is inverted on the v axis.
-                if (!m_isTiled)
+    void TerrainData::TriangulateBlock(
+        float maxError, Tile& tile, size_t firstColumn, size_t firstRow, size_t sectorCount, AZStd::vector<float>& errors)
+    {
+        // Block vertex coordinates are in range [0, sectorCount]. The block is split into two root triangles along its diagonal,
+        // and each triangle is recursively split in half through the midpoint of its hypotenuse.
+        const size_t size = sectorCount + 1U;
+        const auto getHeight = [&tile, firstColumn, firstRow](size_t x, size_t y)
+        {
+            return tile.m_heights[firstRow + y + (firstColumn + x) * tile.m_rowCount];
+        };
+
+        // Border vertices are always used, since the neighbouring blocks are triangulated independently.
+        // Holes and their neighbours are always used as well, so that only the smallest triangles touching the holes are omitted.
+        static constexpr float ForcedError = AZStd::numeric_limits<float>::infinity();
+        errors.assign(size * size, 0.0f);
+        for (size_t x = 0U; x < size; ++x)
+        {
+            for (size_t y = 0U; y < size; ++y)
+            {
+                if (tile.m_isHole[firstRow + y + (firstColumn + x) * tile.m_rowCount] == 0U)
                 {
-                    uv.value[0] /= aznumeric_cast<float>(m_gridColumns);
-                    uv.value[1] /= aznumeric_cast<float>(m_gridRows);
-                    uv.value[1] = 1.0f - uv.value[1];
+                    continue;
                 }
 
-                m_uvs.emplace_back(uv);
+                for (size_t neighbourX = (x > 0U ? x - 1U : x); neighbourX <= AZStd::min(x + 1U, sectorCount); ++neighbourX)
+                {
+                    for (size_t neighbourY = (y > 0U ? y - 1U : y); neighbourY <= AZStd::min(y + 1U, sectorCount); ++neighbourY)
+                    {
+                        errors[neighbourY * size + neighbourX] = ForcedError;
+                    }
+                }
             }
         }
+
+        for (size_t i = 0U; i < size; ++i)
+        {
+            errors[i] = errors[i + sectorCount * size] = ForcedError;
+            errors[i * size] = errors[sectorCount + i * size] = ForcedError;
+        }
+
+        // The error of a midpoint is the interpolation error at the midpoint, combined with the errors of all its descendants,
+        // so that splitting a triangle always splits the triangles it depends on as well (no T-junctions within the block).
+        // Triangles are visited from the smallest ones, using their implicit binary tree indices.
+        const size_t triangleCount = sectorCount * sectorCount * 2U - 2U;
+        const size_t parentTriangleCount = triangleCount - sectorCount * sectorCount;
+        for (size_t triangleIdx = triangleCount; triangleIdx-- > 0U;)
+        {
+            size_t id = triangleIdx + 2U;
+            size_t ax = 0U, ay = 0U, bx = 0U, by = 0U, cx = 0U, cy = 0U;
+            if (id & 1U)
+            {
+                bx = by = cx = sectorCount;
+            }
+            else
+            {
+                ax = ay = cy = sectorCount;
+            }
+
+            while ((id >>= 1U) > 1U)
+            {
+                const size_t mx = (ax + bx) / 2U;
+                const size_t my = (ay + by) / 2U;
+                if (id & 1U)
+                {
+                    bx = ax;
+                    by = ay;
+                    ax = cx;
+                    ay = cy;
+                }
+                else
+                {
+                    ax = bx;
+                    ay = by;
+                    bx = cx;
+                    by = cy;
+                }
+                cx = mx;
+                cy = my;
+            }
+
+            const size_t mx = (ax + bx) / 2U;
+            const size_t my = (ay + by) / 2U;
+            const float interpolatedHeight = (getHeight(ax, ay) + getHeight(bx, by)) * 0.5f;
+            float& middleError = errors[my * size + mx];
+            middleError = AZStd::max(middleError, AZ::GetAbs(interpolatedHeight - getHeight(mx, my)));
+
+            if (triangleIdx < parentTriangleCount)
+            {
+                const size_t leftChildIdx = ((ay + cy) / 2U) * size + (ax + cx) / 2U;
+                const size_t rightChildIdx = ((by + cy) / 2U) * size + (bx + cx) / 2U;
+                middleError = AZStd::max(middleError, AZStd::max(errors[leftChildIdx], errors[rightChildIdx]));
+            }
+        }
+
+        const auto getVertexIdx = [&tile, firstColumn, firstRow](size_t x, size_t y)
+        {
+            return aznumeric_cast<int32_t>(firstRow + y + (firstColumn + x) * tile.m_rowCount);
+        };
+
+        // Triangles are split while the error of their hypotenuse midpoint exceeds the maximal error.
+        const auto processTriangle = [&](const auto& self, size_t ax, size_t ay, size_t bx, size_t by, size_t cx, size_t cy) -> void
+        {
+            const size_t mx = (ax + bx) / 2U;
+            const size_t my = (ay + by) / 2U;
+            const size_t legLength = (ax > cx ? ax - cx : cx - ax) + (ay > cy ? ay - cy : cy - ay);
+            if (legLength > 1U && errors[my * size + mx] > maxError)
+            {
+                self(self, cx, cy, ax, ay, mx, my);
+                self(self, bx, by, cx, cy, mx, my);
+                return;
+            }
+
+            // Vertices are ordered counterclockwise (as seen from above), matching the regular triangulation.
+            const auto abX = aznumeric_cast<AZ::s64>(bx) - aznumeric_cast<AZ::s64>(ax);
+            const auto abY = aznumeric_cast<AZ::s64>(by) - aznumeric_cast<AZ::s64>(ay);
+            const auto acX = aznumeric_cast<AZ::s64>(cx) - aznumeric_cast<AZ::s64>(ax);
+            const auto acY = aznumeric_cast<AZ::s64>(cy) - aznumeric_cast<AZ::s64>(ay);
+            if (abX * acY - abY * acX > 0)
+            {
+                AddTriangle(tile, rgl_vec3i{ getVertexIdx(ax, ay), getVertexIdx(bx, by), getVertexIdx(cx, cy) }, tile.m_indices);
+            }
+            else
+            {
+                AddTriangle(tile, rgl_vec3i{ getVertexIdx(ax, ay), getVertexIdx(cx, cy), getVertexIdx(bx, by) }, tile.m_indices);
+            }
+        };
+
+        processTriangle(processTriangle, 0U, 0U, sectorCount, sectorCount, sectorCount, 0U);
+        processTriangle(processTriangle, sectorCount, sectorCount, 0U, 0U, 0U, sectorCount);
+    }
+
+    void TerrainData::CollectVertices(const Tile& tile, AZStd::vector<rgl_vec3f>& vertices) const
+    {
+        AZ_Assert(tile.m_rowCount <= MaxTileRowCount, "Tile exceeds the maximal number of rows.");
+        vertices.resize_no_construct(tile.m_columnCount * tile.m_rowCount);
+
+        // The y coordinates are shared by all columns, so each column is packed from them and its heights using SIMD.
+        AZStd::array<float, MaxTileRowCount> positionsY;
+        const float spacingY = m_grid.m_spacing.GetY();
+        for (size_t vertexIndexY = 0LU; vertexIndexY < tile.m_rowCount; ++vertexIndexY)
+        {
+            positionsY[vertexIndexY] = aznumeric_cast<float>(tile.m_firstRow + aznumeric_cast<AZ::s64>(vertexIndexY)) * spacingY;
+        }
+
+        const float spacingX = m_grid.m_spacing.GetX();
+        for (size_t vertexIndexX = 0LU; vertexIndexX < tile.m_columnCount; ++vertexIndexX)
+        {
+            const float positionX = aznumeric_cast<float>(tile.m_firstColumn + aznumeric_cast<AZ::s64>(vertexIndexX)) * spacingX;
+            const size_t columnOffset = vertexIndexX * tile.m_rowCount;
+            Utils::RglVec3fsFromComponents(
+                positionX, positionsY.data(), tile.m_heights.data() + columnOffset, tile.m_rowCount, vertices.data() + columnOffset);
+        }
+    }
+
+    const AZStd::vector<rgl_vec3i>& TerrainData::CollectIndices(const Tile& tile, AZStd::vector<rgl_vec3i>& indices) const
+    {
+        if (m_settings.m_meshConfig.m_isAdaptive)
+        {
+            return tile.m_indices;
+        }
+
+        GenerateRegularIndices(tile, indices);
+        return indices;
+    }
+
+    void TerrainData::CollectUvs(const Tile& tile, AZStd::vector<rgl_vec2f>& uvs) const
+    {
+        AZ_Assert(tile.m_rowCount <= MaxTileRowCount, "Tile exceeds the maximal number of rows.");
+        const Grid& grid = m_grid;
+        const UvMapping uvMapping = m_settings.m_uvMapping;
+        uvs.resize_no_construct(tile.m_columnCount * tile.m_rowCount);
+
+        // One UV component depends only on the row and is shared by all columns, the other one is constant within a column.
+        // Each column is packed from them using SIMD.
+        AZStd::array<float, MaxTileRowCount> rowComponents;
+
+        // The per-tile texture has one texel per vertex, laid out like the vertices (rows of the texture are tile columns).
+        // UVs point at the texel centers.
+        if (uvMapping == UvMapping::PerTile)
+        {
+            const float texelWidth = 1.0f / aznumeric_cast<float>(tile.m_rowCount);
+            const float texelHeight = 1.0f / aznumeric_cast<float>(tile.m_columnCount);
+            for (size_t y = 0; y < tile.m_rowCount; ++y)
+            {
+                rowComponents[y] = (aznumeric_cast<float>(y) + 0.5f) * texelWidth;
+            }
+
+            for (size_t x = 0; x < tile.m_columnCount; ++x)
+            {
+                const float v = (aznumeric_cast<float>(x) + 0.5f) * texelHeight;
+                Utils::RglVec2fsFromComponents(v, rowComponents.data(), tile.m_rowCount, false, uvs.data() + x * tile.m_rowCount);
+            }
+
+            return;
+        }
+
+        // Tiled UVs are counted from the world origin, so that they do not change along with the terrain bounds.
+        AZ::s64 firstX = tile.m_firstColumn;
+        AZ::s64 firstY = tile.m_firstRow;
+        float scaleX = 1.0f, scaleY = 1.0f;
+        float offsetY = 0.0f;
+        if (uvMapping == UvMapping::Stretched)
+        {
+            firstX -= grid.m_firstColumn;
+            firstY -= grid.m_firstRow;
+            scaleX = 1.0f / aznumeric_cast<float>(grid.m_columnCount);
+            // Terrain Macro Material's image
+            // is inverted on the v axis.
+            scaleY = -1.0f / aznumeric_cast<float>(grid.m_rowCount);
+            offsetY = 1.0f;
+        }
+
+        for (size_t y = 0; y < tile.m_rowCount; ++y)
+        {
+            rowComponents[y] = offsetY + aznumeric_cast<float>(firstY + aznumeric_cast<AZ::s64>(y)) * scaleY;
+        }
+
+        for (size_t x = 0; x < tile.m_columnCount; ++x)
+        {
+            const float u = aznumeric_cast<float>(firstX + aznumeric_cast<AZ::s64>(x)) * scaleX;
+            Utils::RglVec2fsFromComponents(u, rowComponents.data(), tile.m_rowCount, true, uvs.data() + x * tile.m_rowCount);
+        }
+    }
+
+    TerrainData::VertexDataChanges TerrainData::QueryVertexData(
+        const Grid& grid,
+        const SurfaceIntensityTable& surfaceIntensities,
+        Tile& tile,
+        size_t columnBegin,
+        size_t columnEnd,
+        size_t rowBegin,
+        size_t rowEnd)
+    {
+        using TerrainDataMask = AzFramework::Terrain::TerrainDataRequests::TerrainDataMask;
+
+        const AZ::Vector2 startPoint = AZ::Vector2(
+                                           aznumeric_cast<float>(tile.m_firstColumn + aznumeric_cast<AZ::s64>(columnBegin)),
+                                           aznumeric_cast<float>(tile.m_firstRow + aznumeric_cast<AZ::s64>(rowBegin))) *
+            grid.m_spacing;
+        const AzFramework::Terrain::TerrainQueryRegion queryRegion(startPoint, columnEnd - columnBegin, rowEnd - rowBegin, grid.m_spacing);
+
+        // Surface tags are only queried if they are mapped to intensities.
+        const bool isIntensityQueried = surfaceIntensities.m_isEnabled && !tile.m_intensities.empty();
+        const TerrainDataMask dataMask =
+            isIntensityQueried ? (TerrainDataMask::Heights | TerrainDataMask::SurfaceData) : TerrainDataMask::Heights;
+
+        VertexDataChanges changes;
+        auto writeVertexData =
+            [&tile, &changes, &surfaceIntensities, isIntensityQueried, columnBegin, rowBegin](
+                size_t xIndex, size_t yIndex, const AzFramework::SurfaceData::SurfacePoint& surfacePoint, bool terrainExists)
+        {
+            const size_t vertexIdx = rowBegin + yIndex + (columnBegin + xIndex) * tile.m_rowCount;
+            const AZ::u8 isHole = terrainExists ? 0U : 1U;
+            changes.m_areHolesChanged |= tile.m_isHole[vertexIdx] != isHole;
+            tile.m_isHole[vertexIdx] = isHole;
+            if (!terrainExists)
+            {
+                return;
+            }
+
+            tile.m_heights[vertexIdx] = surfacePoint.m_position.GetZ();
+            if (isIntensityQueried)
+            {
+                const AZ::u8 intensity = surfaceIntensities.GetIntensity(surfacePoint.m_surfaceTags);
+                changes.m_areIntensitiesChanged |= tile.m_intensities[vertexIdx] != intensity;
+                tile.m_intensities[vertexIdx] = intensity;
+            }
+        };
+
+        // Sampler::Exact is used because mesh vertices are created directly on grid provided from heightfield.
+        AzFramework::Terrain::TerrainDataRequestBus::Broadcast(
+            &AzFramework::Terrain::TerrainDataRequests::QueryRegion,
+            queryRegion,
+            dataMask,
+            writeVertexData,
+            AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT);
+        return changes;
+    }
+
+    TerrainData::Tile TerrainData::CreateTileExtents(AZ::s64 tileX, AZ::s64 tileY) const
+    {
+        const AZ::s64 gridLastColumn = m_grid.m_firstColumn + aznumeric_cast<AZ::s64>(m_grid.m_columnCount) - 1;
+        const AZ::s64 gridLastRow = m_grid.m_firstRow + aznumeric_cast<AZ::s64>(m_grid.m_rowCount) - 1;
+        const AZ::s64 lastColumn = AZStd::min((tileX + 1) * TileSectorCount, gridLastColumn);
+        const AZ::s64 lastRow = AZStd::min((tileY + 1) * TileSectorCount, gridLastRow);
+
+        Tile tile;
+        tile.m_firstColumn = AZStd::max(tileX * TileSectorCount, m_grid.m_firstColumn);
+        tile.m_firstRow = AZStd::max(tileY * TileSectorCount, m_grid.m_firstRow);
+        tile.m_columnCount = aznumeric_cast<size_t>(lastColumn - tile.m_firstColumn + 1);
+        tile.m_rowCount = aznumeric_cast<size_t>(lastRow - tile.m_firstRow + 1);
+        return tile;
+    }
+
+    float TerrainData::GetDistanceToTile(const AZ::Vector3& position, const Tile& tile) const
+    {
+        const AZ::Vector2 tileMin =
+            AZ::Vector2(aznumeric_cast<float>(tile.m_firstColumn), aznumeric_cast<float>(tile.m_firstRow)) * m_grid.m_spacing;
+        const AZ::Vector2 tileMax = AZ::Vector2(
+                                        aznumeric_cast<float>(tile.m_firstColumn + aznumeric_cast<AZ::s64>(tile.m_columnCount) - 1),
+                                        aznumeric_cast<float>(tile.m_firstRow + aznumeric_cast<AZ::s64>(tile.m_rowCount) - 1)) *
+            m_grid.m_spacing;
+        const AZ::Vector2 position2D(position);
+        return position2D.GetDistance(position2D.GetClamp(tileMin, tileMax));
+    }
+
+    void TerrainData::BuildMissingTiles(const TileMap* previousTiles)
+    {
+        AZStd::vector<AZStd::pair<Tile*, const Tile*>> createdTiles;
+        for (AZ::s64 tileX = m_tileXBegin; tileX < m_tileXEnd; ++tileX)
+        {
+            for (AZ::s64 tileY = m_tileYBegin; tileY < m_tileYEnd; ++tileY)
+            {
+                auto [tileIt, isCreated] = m_tiles.try_emplace(GetTileKey(tileX, tileY));
+                if (isCreated)
+                {
+                    tileIt->second = CreateTileExtents(tileX, tileY);
+                    tileIt->second.m_revision = ++m_tileRevision;
+
+                    const Tile* previousTile = nullptr;
+                    if (previousTiles)
+                    {
+                        const auto previousTileIt = previousTiles->find(tileIt->first);
+                        previousTile = previousTileIt != previousTiles->end() ? &previousTileIt->second : nullptr;
+                    }
+                    createdTiles.emplace_back(&tileIt->second, previousTile);
+                }
+            }
+        }
+
+        Utils::ParallelFor(
+            createdTiles.size(),
+            1U,
+            [this, &createdTiles](size_t begin, size_t end)
+            {
+                for (size_t tileIdx = begin; tileIdx < end; ++tileIdx)
+                {
+                    BuildTile(m_grid, m_settings, *createdTiles[tileIdx].first, createdTiles[tileIdx].second);
+                }
+            });
+    }
+
+    void TerrainData::DropTileBuilds()
+    {
+        for (auto& [key, tileBuild] : m_tileBuilds)
+        {
+            m_droppedTileBuilds.push_back(AZStd::move(tileBuild));
+        }
+
+        m_tileBuilds.clear();
     }
 } // namespace RGL
@@ -15,38 +15,204 @@
 #pragma once
 
 #include <AzCore/Math/Aabb.h>
+#include <AzCore/Math/Vector2.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
+#include <AzCore/std/tuple.h>
+#include <AzFramework/SurfaceData/SurfaceData.h>
+#include <Lidar/LidarVolume.h>
+#include <RGL/SceneConfiguration.h>
 #include <rgl/api/core.h>
 
 namespace RGL
 {
+    //! Regular grid of terrain vertices aligned with the heightfield grid.
+    //! Only the heights of the vertices are stored. Vertex positions, UVs and the regular triangulation are generated from the grid
+    //! parameters when the tiles are uploaded.
+    //! With adaptive triangulation enabled, flat parts of the grid are covered by fewer, larger triangles.
+    //! The grid is split into square tiles, so that changes of the terrain only affect the tiles they overlap.
+    //! With geometry streaming enabled, only the tiles within the range of lidars are created, in the background.
     class TerrainData
     {
     public:
+        //! Part of the terrain grid represented by a single RGL mesh. Neighbouring tiles share the vertices on their borders.
+        //! Per-vertex data is stored column by column (vertices of consecutive rows are adjacent).
+        struct Tile
+        {
+            AZStd::vector<float> m_heights;
+            //! Indices of the adaptive triangulation. Empty for the regular triangulation, which is generated on demand.
+            AZStd::vector<rgl_vec3i> m_indices;
+            //! Non-zero for vertices where the terrain does not exist. Triangles touching these vertices are omitted.
+            AZStd::vector<AZ::u8> m_isHole;
+            //! Intensities of the vertices, based on their surface tags. Empty unless surface tag intensities are enabled.
+            //! Laid out as a texture with one texel per vertex, m_rowCount texels wide and m_columnCount texels high.
+            AZStd::vector<AZ::u8> m_intensities;
+            //! Grid indices of the first vertex of the tile, counted from the world origin.
+            AZ::s64 m_firstColumn{ 0 }, m_firstRow{ 0 };
+            size_t m_columnCount{ 0U }, m_rowCount{ 0U };
+            //! Changes whenever the tile is rebuilt (e.g. its extents, UVs or triangles change), so that its RGL mesh has to be recreated.
+            AZ::u32 m_revision{ 0U };
+            //! Changes whenever the intensities of the tile change, so that its intensity texture has to be recreated.
+            AZ::u32 m_intensityRevision{ 0U };
+        };
+
+        using TileKey = AZ::u64;
+        using TileMap = AZStd::unordered_map<TileKey, Tile>;
+
+        TerrainData() = default;
+        TerrainData(const TerrainData& other) = delete;
+        ~TerrainData();
+
         //! Returns whether or not newWorldBounds resulted in terrain update.
+        //! Tiles covering the same part of the grid as before are kept.
+        //! Without streaming, other tiles are created with their heights fetched.
         bool UpdateBounds(const AZ::Aabb& newWorldBounds);
-        void UpdateDirtyRegion(const AZ::Aabb& dirtyRegion);
+        //! Fetches the heights (and surface tag intensities) of all grid vertices within the xy - projection of the dirty region.
+        //! If holes changed (or adaptive triangulation is enabled), the updated tiles are triangulated again and their revisions change.
+        //! If intensities changed, the intensity revisions of the updated tiles change.
+        //! @param updatedTiles Filled with the keys of the tiles whose vertices were updated.
+        void UpdateDirtyRegion(const AZ::Aabb& dirtyRegion, AZStd::vector<TileKey>& updatedTiles);
+        //! Adds tiles within the range of the lidars (extended by the margin) and removes tiles exceeding it by the hysteresis.
+        //! New tiles are built in the background and added in one of the subsequent calls. Has to be called from the main thread.
+        //! If streaming is disabled, all tiles of the grid are kept.
+        //! @return True if any tile was added or removed.
+        bool UpdateStreaming(const AZStd::vector<LidarVolume>& lidarVolumes, const GeometryStreamingConfiguration& config);
 
+        //! Deletes all tiles. Waits for the tiles already being built in the background.
         void Clear();
-        void SetIsTiled(bool isTiled);
+        //! Updates the UV mapping (and intensities) of all tiles if the UV mapping or the surface tag intensities changed.
+        void SetIntensityConfiguration(const TerrainIntensityConfiguration& intensityConfig);
+        //! Triangulates all tiles again if the configuration changed.
+        void SetMeshConfiguration(const TerrainMeshConfiguration& meshConfig);
 
-        [[nodiscard]] const AZStd::vector<rgl_vec3f>& GetVertices() const;
-        [[nodiscard]] const AZStd::vector<rgl_vec3i>& GetIndices() const;
-        [[nodiscard]] const AZStd::vector<rgl_vec2f>& GetUvs() const;
+        [[nodiscard]] const TileMap& GetTiles() const;
+
+        //! Generates the vertex positions of the tile into the provided buffer, reusing its capacity.
+        void CollectVertices(const Tile& tile, AZStd::vector<rgl_vec3f>& vertices) const;
+        //! Generates the UVs of the tile into the provided buffer, reusing its capacity.
+        void CollectUvs(const Tile& tile, AZStd::vector<rgl_vec2f>& uvs) const;
+        //! Returns the indices of the tile. The regular triangulation is generated into the provided buffer.
+        [[nodiscard]] const AZStd::vector<rgl_vec3i>& CollectIndices(const Tile& tile, AZStd::vector<rgl_vec3i>& indices) const;
 
     private:
-        void UpdateUvs();
+        //! Mapping of the intensity texture onto the terrain.
+        enum class UvMapping
+        {
+            Tiled, //!< One texture repetition per grid sector.
+            Stretched, //!< The texture is stretched over the whole grid.
+            PerTile, //!< Each tile uses its own intensity texture with one texel per vertex.
+        };
+
+        //! Intensities assigned to the terrain surface tags, used instead of the intensity texture if enabled.
+        struct SurfaceIntensityTable
+        {
+            //! Returns the intensity of the surface tag with the highest weight among the tags present in the table.
+            [[nodiscard]] AZ::u8 GetIntensity(const AzFramework::SurfaceData::SurfaceTagWeightList& surfaceTags) const;
+            bool operator==(const SurfaceIntensityTable& other) const;
+
+            bool m_isEnabled{ false };
+            AZ::u8 m_defaultIntensity{ 0U }; //!< Intensity of surfaces without any tag present in the table.
+            AZStd::vector<AZStd::pair<AZ::Crc32, AZ::u8>> m_intensities;
+        };
+
+        //! Settings used to build the tiles. Copied into the jobs building the tiles in the background.
+        struct BuildSettings
+        {
+            UvMapping m_uvMapping{ UvMapping::Tiled };
+            TerrainMeshConfiguration m_meshConfig;
+            SurfaceIntensityTable m_surfaceIntensities;
+        };
+
+        //! Describes which vertex data changed after the terrain was queried.
+        struct VertexDataChanges
+        {
+            bool m_areHolesChanged{ false };
+            bool m_areIntensitiesChanged{ false };
+        };
+
+        //! Regular grid of terrain vertices, aligned with the heightfield grid.
+        struct Grid
+        {
+            //! Grid indices of the first grid vertex, counted from the world origin.
+            AZ::s64 m_firstColumn{ 0 }, m_firstRow{ 0 };
+            size_t m_columnCount{ 0U }, m_rowCount{ 0U };
+            //! Distance between consecutive vertices along the x and y axes.
+            AZ::Vector2 m_spacing{ AZ::Vector2::CreateOne() };
+        };
+
+        //! Shared with the job building the tile, so that it stays valid even if the tile is no longer needed.
+        struct TileBuild
+        {
+            Tile m_tile;
+            AZStd::atomic_bool m_isDone{ false };
+        };
+
+        //! Fetches the heights (and intensities) of the tile and triangulates it.
+        //! @param previousTile Optional tile previously covering a part of the same grid area. Its data is reused where they overlap.
+        static void BuildTile(const Grid& grid, const BuildSettings& settings, Tile& tile, const Tile* previousTile);
+        //! Copies the heights, holes and intensities of the source tile vertices which overlap the tile.
+        //! @return Ranges [begin, end) of tile columns and rows with copied data. Empty if the tiles do not overlap.
+        static AZStd::tuple<size_t, size_t, size_t, size_t> CopyOverlappingVertexData(const Tile& source, Tile& tile);
+        //! Creates the indices of the adaptive triangulation, based on the vertex heights.
+        //! Releases the indices if the regular triangulation is used.
+        static void TriangulateTile(const TerrainMeshConfiguration& meshConfig, Tile& tile);
+        //! Generates two triangles per tile sector, omitting the triangles touching holes.
+        static void GenerateRegularIndices(const Tile& tile, AZStd::vector<rgl_vec3i>& indices);
+        //! Adds the triangle to the indices, unless it touches a hole of the tile.
+        static void AddTriangle(const Tile& tile, const rgl_vec3i& triangle, AZStd::vector<rgl_vec3i>& indices);
+        //! Covers the provided range of tile sectors with square blocks of power of two sectors and triangulates each block.
+        static void TriangulateAdaptively(
+            float maxError,
+            Tile& tile,
+            size_t firstColumn,
+            size_t firstRow,
+            size_t columnSectorCount,
+            size_t rowSectorCount,
+            AZStd::vector<float>& errors);
+        //! Triangulates a square block of tile sectors using a right-triangulated irregular network (RTIN).
+        //! The vertices on the block borders are always used, so that the blocks (and tiles) are connected without cracks.
+        //! @param errors Buffer for the errors of the block vertices, reused between blocks.
+        static void TriangulateBlock(
+            float maxError, Tile& tile, size_t firstColumn, size_t firstRow, size_t sectorCount, AZStd::vector<float>& errors);
+        //! Fetches the heights, holes and (if enabled) surface tag intensities of the provided ranges of tile columns and rows.
+        static VertexDataChanges QueryVertexData(
+            const Grid& grid,
+            const SurfaceIntensityTable& surfaceIntensities,
+            Tile& tile,
+            size_t columnBegin,
+            size_t columnEnd,
+            size_t rowBegin,
+            size_t rowEnd);
+
+        //! Returns a tile without geometry, covering the part of the grid belonging to the tile with the provided tile indices.
+        [[nodiscard]] Tile CreateTileExtents(AZ::s64 tileX, AZ::s64 tileY) const;
+        //! Returns the distance between the xy - projections of the position and the tile.
+        [[nodiscard]] float GetDistanceToTile(const AZ::Vector3& position, const Tile& tile) const;
+        //! Synchronously builds all tiles of the grid which were not built yet, in parallel.
+        //! @param previousTiles Optional tiles previously covering the same tile keys, whose heights are reused.
+        void BuildMissingTiles(const TileMap* previousTiles);
+        //! Drops the tiles being built in the background. Their results are discarded once the builds are done.
+        void DropTileBuilds();
 
         static constexpr size_t TrianglesPerSector = 2LU;
 
         AZ::Aabb m_currentWorldBounds = { AZ::Aabb::CreateFromPoint(AZ::Vector3::CreateZero()) };
 
-        AZStd::vector<rgl_vec3f> m_vertices;
-        AZStd::vector<rgl_vec3i> m_indices;
-        AZStd::vector<rgl_vec2f> m_uvs;
+        TileMap m_tiles;
+        //! Tiles being built in the background.
+        AZStd::unordered_map<TileKey, AZStd::shared_ptr<TileBuild>> m_tileBuilds;
+        //! Builds which are no longer needed. Kept until they are done, so that Clear can wait for them.
+        AZStd::vector<AZStd::shared_ptr<TileBuild>> m_droppedTileBuilds;
+        AZ::u32 m_tileRevision{ 0U };
 
-        size_t m_gridRows{ 0U }, m_gridColumns{ 0U };
+        Grid m_grid;
+        //! Range [begin, end) of tile indices covering the grid along the x and y axes.
+        AZ::s64 m_tileXBegin{ 0 }, m_tileXEnd{ 0 }, m_tileYBegin{ 0 }, m_tileYEnd{ 0 };
 
-        bool m_isTiled{ true };
+        BuildSettings m_settings;
+        bool m_isStreamingEnabled{ false };
     };
 
 } // namespace RGL
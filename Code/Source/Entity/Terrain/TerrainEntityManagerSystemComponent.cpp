@@ -29,7 +29,7 @@ namespace RGL
     void TerrainEntityManagerSystemComponent::OnTerrainDataDestroyEnd()
     {
         m_terrainData.Clear();
-        EnsureRGLEntityDestroyed();
+        EnsureRGLEntitiesDestroyed();
     }
 
     void TerrainEntityManagerSystemComponent::Activate()
@@ -38,14 +38,18 @@ namespace RGL
             Utils::PackRglEntityId(ROS2Sensors::SegmentationIds{ Utils::GenerateSegmentationEntityId(), ROS2Sensors::TerrainClassId });
         AzFramework::Terrain::TerrainDataNotificationBus::Handler::BusConnect();
         RGLNotificationBus::Handler::BusConnect();
+        LidarSystemNotificationBus::Handler::BusConnect();
+        MemoryUsageRequestBus::Handler::BusConnect();
     }
 
     void TerrainEntityManagerSystemComponent::Deactivate()
     {
+        MemoryUsageRequestBus::Handler::BusDisconnect();
         AzFramework::Terrain::TerrainDataNotificationBus::Handler::BusDisconnect();
         RGLNotificationBus::Handler::BusDisconnect();
+        LidarSystemNotificationBus::Handler::BusDisconnect();
         m_terrainData.Clear();
-        EnsureRGLEntityDestroyed();
+        EnsureRGLEntitiesDestroyed();
     }
 
     Wrappers::RglTexture TerrainEntityManagerSystemComponent::CreateTextureFromConfig(const TerrainIntensityConfiguration& intensityConfig)
@@ -68,12 +72,21 @@ namespace RGL
     {
         const auto& intensityConfig = RGLInterface::Get()->GetSceneConfiguration().m_terrainIntensityConfig;
         m_rglTexture = AZStd::move(CreateTextureFromConfig(intensityConfig));
-        if (m_rglTexture.IsValid() && m_rglEntity.IsValid())
+        if (m_rglTexture.IsValid())
         {
-            m_rglEntity.SetIntensityTexture(m_rglTexture);
+            for (auto& [key, tileEntity] : m_tileEntities)
+            {
+                if (tileEntity.m_rglEntity.IsValid() && !tileEntity.m_rglTexture.IsValid())
+                {
+                    tileEntity.m_rglEntity.SetIntensityTexture(m_rglTexture);
+                }
+            }
         }
 
-        m_terrainData.SetIsTiled(intensityConfig.m_isTiled);
+        // Changing the UV mapping or the triangulation rebuilds all tiles.
+        m_terrainData.SetIntensityConfiguration(intensityConfig);
+        m_terrainData.SetMeshConfiguration(config.m_terrainMeshConfig);
+        UpdateTileEntities();
     }
 
     void TerrainEntityManagerSystemComponent::OnAnyLidarExists()
@@ -85,7 +98,27 @@ namespace RGL
     {
         AzFramework::Terrain::TerrainDataNotificationBus::Handler::BusDisconnect();
         m_terrainData.Clear();
-        EnsureRGLEntityDestroyed();
+        EnsureRGLEntitiesDestroyed();
+    }
+
+    void TerrainEntityManagerSystemComponent::OnLidarVolumesUpdated(const AZStd::vector<LidarVolume>& lidarVolumes)
+    {
+        const GeometryStreamingConfiguration& streamingConfig = RGLInterface::Get()->GetSceneConfiguration().m_geometryStreamingConfig;
+        if (m_terrainData.UpdateStreaming(lidarVolumes, streamingConfig))
+        {
+            UpdateTileEntities();
+        }
+    }
+
+    void TerrainEntityManagerSystemComponent::CollectMemoryUsage(MemoryUsageReport& report) const
+    {
+        MemoryUsage& terrainUsage = report.m_other["Terrain"];
+        for (const auto& [key, tileEntity] : m_tileEntities)
+        {
+            terrainUsage += tileEntity.m_rglMesh.GetMemoryUsage();
+            terrainUsage += tileEntity.m_rglTexture.GetMemoryUsage();
+        }
+        terrainUsage += m_rglTexture.GetMemoryUsage();
     }
 
     void TerrainEntityManagerSystemComponent::Reflect(AZ::ReflectContext* context)
@@ -120,10 +153,9 @@ namespace RGL
         required.push_back(AZ_CRC_CE("RGLService"));
     }
 
-    void TerrainEntityManagerSystemComponent::EnsureRGLEntityDestroyed()
+    void TerrainEntityManagerSystemComponent::EnsureRGLEntitiesDestroyed()
     {
-        m_rglEntity = AZStd::move(Wrappers::RglEntity::CreateInvalid());
-        m_rglMesh = AZStd::move(Wrappers::RglMesh::CreateInvalid());
+        m_tileEntities.clear();
     }
 
     void TerrainEntityManagerSystemComponent::UpdateWorldBounds()
@@ -134,51 +166,135 @@ namespace RGL
 
         if (!m_terrainData.UpdateBounds(newWorldBounds))
         {
-            // The terrain data was not updated. No need to update the RGL mesh.
+            // The terrain data was not updated. No need to update the RGL meshes.
             return;
         }
 
-        EnsureRGLEntityDestroyed();
+        UpdateTileEntities();
+    }
+
+    void TerrainEntityManagerSystemComponent::UpdateDirtyRegion(const AZ::Aabb& dirtyRegion)
+    {
+        // The terrain data is updated even without any tiles, since the tiles being built in the background may be outdated.
+        const TerrainData::TileMap& tiles = m_terrainData.GetTiles();
+        m_terrainData.UpdateDirtyRegion(dirtyRegion, m_updatedTiles);
+        for (const TerrainData::TileKey key : m_updatedTiles)
+        {
+            const auto tileEntityIt = m_tileEntities.find(key);
+            if (tileEntityIt == m_tileEntities.end())
+            {
+                continue;
+            }
+
+            // Adaptively triangulated tiles change their triangles along with the heights.
+            const TerrainData::Tile& tile = tiles.at(key);
+            if (tileEntityIt->second.m_revision != tile.m_revision)
+            {
+                CreateTileEntity(tile, tileEntityIt->second);
+                continue;
+            }
+
+            if (tileEntityIt->second.m_intensityRevision != tile.m_intensityRevision)
+            {
+                UpdateTileTexture(tile, tileEntityIt->second);
+            }
+
+            if (tileEntityIt->second.m_rglEntity.IsValid())
+            {
+                // The vertices are collected into a pooled buffer, handed over to the RGL command without copying.
+                Utils::RglBufferPool<rgl_vec3f>::BufferPtr vertices = Utils::RglBufferPool<rgl_vec3f>::Get().Acquire();
+                m_terrainData.CollectVertices(tile, *vertices);
+                const size_t vertexCount = vertices->size();
+                tileEntityIt->second.m_rglEntity.ApplyExternalAnimation(AZStd::move(vertices), 0U, vertexCount);
+            }
+        }
+    }
+
+    void TerrainEntityManagerSystemComponent::UpdateTileEntities()
+    {
+        const TerrainData::TileMap& tiles = m_terrainData.GetTiles();
+        for (auto tileEntityIt = m_tileEntities.begin(); tileEntityIt != m_tileEntities.end();)
+        {
+            tileEntityIt = tiles.contains(tileEntityIt->first) ? AZStd::next(tileEntityIt) : m_tileEntities.erase(tileEntityIt);
+        }
 
-        const auto& vertices = m_terrainData.GetVertices();
-        const auto& indices = m_terrainData.GetIndices();
+        for (const auto& [key, tile] : tiles)
+        {
+            auto [tileEntityIt, isCreated] = m_tileEntities.try_emplace(key);
+            if (isCreated || tileEntityIt->second.m_revision != tile.m_revision)
+            {
+                CreateTileEntity(tile, tileEntityIt->second);
+            }
+            else if (tileEntityIt->second.m_intensityRevision != tile.m_intensityRevision)
+            {
+                UpdateTileTexture(tile, tileEntityIt->second);
+            }
+        }
+    }
+
+    void TerrainEntityManagerSystemComponent::CreateTileEntity(const TerrainData::Tile& tile, TileEntity& tileEntity)
+    {
+        // The entity has to be destroyed before its mesh.
+        tileEntity.m_rglEntity = AZStd::move(Wrappers::RglEntity::CreateInvalid());
+        tileEntity.m_revision = tile.m_revision;
 
-        m_rglMesh = AZStd::move(Wrappers::RglMesh(vertices.data(), vertices.size(), indices.data(), indices.size()));
-        if (!m_rglMesh.IsValid())
+        // Tiles consisting of holes only have no triangles.
+        const AZStd::vector<rgl_vec3i>& indices = m_terrainData.CollectIndices(tile, m_stagingIndices);
+        if (indices.empty())
+        {
+            tileEntity.m_rglMesh = AZStd::move(Wrappers::RglMesh::CreateInvalid());
+            return;
+        }
+
+        m_terrainData.CollectVertices(tile, m_stagingVertices);
+        tileEntity.m_rglMesh =
+            AZStd::move(Wrappers::RglMesh(m_stagingVertices.data(), m_stagingVertices.size(), indices.data(), indices.size()));
+        if (!tileEntity.m_rglMesh.IsValid())
         {
             AZ_Assert(false, "The TerrainEntityManager was unable to create an RGL mesh.");
             return;
         }
 
-        const auto& uvs = m_terrainData.GetUvs();
-        m_rglMesh.SetTextureCoordinates(uvs.data(), uvs.size());
+        Utils::RglBufferPool<rgl_vec2f>::BufferPtr uvs = Utils::RglBufferPool<rgl_vec2f>::Get().Acquire();
+        m_terrainData.CollectUvs(tile, *uvs);
+        tileEntity.m_rglMesh.SetTextureCoordinates(AZStd::move(uvs));
 
-        m_rglEntity = AZStd::move(Wrappers::RglEntity(m_rglMesh));
-        if (!m_rglEntity.IsValid())
+        tileEntity.m_rglEntity = AZStd::move(Wrappers::RglEntity(tileEntity.m_rglMesh));
+        if (!tileEntity.m_rglEntity.IsValid())
         {
             AZ_Assert(false, "The TerrainEntityManager was unable to create an RGL entity.");
             return;
         }
 
-        m_rglEntity.SetId(m_packedRglEntityId);
-        m_rglEntity.SetTransform(Utils::IdentityTransform);
-        if (m_rglTexture.IsValid())
-        {
-            m_rglEntity.SetIntensityTexture(m_rglTexture);
-        }
+        tileEntity.m_rglEntity.SetId(m_packedRglEntityId);
+        tileEntity.m_rglEntity.SetTransform(Utils::IdentityTransform);
+        UpdateTileTexture(tile, tileEntity);
     }
 
-    void TerrainEntityManagerSystemComponent::UpdateDirtyRegion(const AZ::Aabb& dirtyRegion)
+    void TerrainEntityManagerSystemComponent::UpdateTileTexture(const TerrainData::Tile& tile, TileEntity& tileEntity) const
     {
-        const auto& vertices = m_terrainData.GetVertices();
-        if (vertices.empty())
+        tileEntity.m_intensityRevision = tile.m_intensityRevision;
+        if (tile.m_intensities.empty())
         {
-            // Dirty regions can only be updated after data creation and before destruction. (See TerrainDataRequests).
+            if (tileEntity.m_rglEntity.IsValid() && m_rglTexture.IsValid())
+            {
+                tileEntity.m_rglEntity.SetIntensityTexture(m_rglTexture);
+            }
+
+            tileEntity.m_rglTexture = AZStd::move(Wrappers::RglTexture::CreateInvalid());
             return;
         }
 
-        m_terrainData.UpdateDirtyRegion(dirtyRegion);
-        m_rglEntity.ApplyExternalAnimation(vertices.data(), vertices.size());
+        // The texels are laid out like the tile vertices, so the tile intensities are used directly.
+        Wrappers::RglTexture texture(tile.m_intensities.data(), tile.m_rowCount, tile.m_columnCount);
+        const Wrappers::RglTexture& appliedTexture = texture.IsValid() ? texture : m_rglTexture;
+        if (tileEntity.m_rglEntity.IsValid() && appliedTexture.IsValid())
+        {
+            tileEntity.m_rglEntity.SetIntensityTexture(appliedTexture);
+        }
+
+        // The previous texture is released only after the entity stopped using it.
+        tileEntity.m_rglTexture = AZStd::move(texture);
     }
 
     void TerrainEntityManagerSystemComponent::OnTerrainDataChanged(const AZ::Aabb& dirtyRegion, TerrainDataChangedMask dataChangedMask)
@@ -188,7 +304,12 @@ namespace RGL
             UpdateWorldBounds();
         }
 
-        if ((dataChangedMask & TerrainDataChangedMask::HeightData) != TerrainDataChangedMask::None)
+        // Surface tags only matter if they are mapped to intensities.
+        const bool isSurfaceDataUsed = RGLInterface::Get()->GetSceneConfiguration().m_terrainIntensityConfig.m_isSurfaceTagIntensityEnabled;
+        const TerrainDataChangedMask updatedDataMask = isSurfaceDataUsed
+            ? (TerrainDataChangedMask::HeightData | TerrainDataChangedMask::SurfaceData)
+            : TerrainDataChangedMask::HeightData;
+        if ((dataChangedMask & updatedDataMask) != TerrainDataChangedMask::None)
         {
             UpdateDirtyRegion(dirtyRegion);
         }
@@ -16,8 +16,11 @@
 
 #include <AzCore/Component/Component.h>
 #include <AzFramework/Terrain/TerrainDataRequestBus.h>
+#include <AzCore/std/containers/unordered_map.h>
 #include <AzFramework/Visibility/BoundsBus.h>
 #include <Entity/Terrain/TerrainData.h>
+#include <Lidar/LidarSystemNotificationBus.h>
+#include <RGL/MemoryUsageBus.h>
 #include <RGL/RGLBus.h>
 #include <Wrappers/RglEntity.h>
 #include <Wrappers/RglMesh.h>
@@ -27,13 +30,18 @@ namespace RGL
 {
     struct TerrainIntensityConfiguration;
 
-    //! Queries the TerrainDataRequestBus for terrain heights and constructs a mesh using them.
-    //! Terrain area is split into square sectors of predetermined width.
-    //! The constructed mesh has a uniform vertex distribution along the xy - plane.
+    //! Queries the TerrainDataRequestBus for terrain heights and constructs meshes using them.
+    //! Terrain area is split into square sectors of predetermined width, grouped into tiles.
+    //! Each tile is represented by a separate RGL mesh and entity, so that terrain changes only update the tiles they overlap.
+    //! The constructed meshes have a uniform vertex distribution along the xy - plane.
+    //! With adaptive triangulation enabled, flat areas are covered by fewer, larger triangles.
+    //! With geometry streaming enabled, only the tiles within the range of lidars are present in the RGL scene.
     class TerrainEntityManagerSystemComponent
         : public AZ::Component
         , private AzFramework::Terrain::TerrainDataNotificationBus::Handler
         , private RGLNotificationBus::Handler
+        , private LidarSystemNotificationBus::Handler
+        , private MemoryUsageRequestBus::Handler
     {
     public:
         AZ_COMPONENT(TerrainEntityManagerSystemComponent, "{6de4556f-5621-4ec3-a587-b28988f79d8a}");
@@ -62,16 +70,44 @@ namespace RGL
         void OnAnyLidarExists() override;
         void OnNoLidarExists() override;
 
-        void EnsureRGLEntityDestroyed();
+        // LidarSystemNotificationBus overrides
+        void OnLidarVolumesUpdated(const AZStd::vector<LidarVolume>& lidarVolumes) override;
+
+        // MemoryUsageRequestBus overrides
+        void CollectMemoryUsage(MemoryUsageReport& report) const override;
+
+        //! RGL mesh and entity representing a terrain tile.
+        struct TileEntity
+        {
+            Wrappers::RglMesh m_rglMesh = Wrappers::RglMesh::CreateInvalid();
+            //! Intensity texture of the tile. Invalid unless surface tag intensities are enabled.
+            Wrappers::RglTexture m_rglTexture = Wrappers::RglTexture::CreateInvalid();
+            Wrappers::RglEntity m_rglEntity = Wrappers::RglEntity::CreateInvalid();
+            //! Revision of the tile the mesh was created from.
+            AZ::u32 m_revision{ 0U };
+            //! Intensity revision of the tile the texture was created from.
+            AZ::u32 m_intensityRevision{ 0U };
+        };
+
+        void EnsureRGLEntitiesDestroyed();
 
         void UpdateWorldBounds();
         void UpdateDirtyRegion(const AZ::Aabb& dirtyRegion);
+        //! Creates (or destroys) tile entities, so that they match the current terrain tiles.
+        void UpdateTileEntities();
+        void CreateTileEntity(const TerrainData::Tile& tile, TileEntity& tileEntity);
+        //! Applies the intensity texture of the tile (or the shared intensity texture) to the tile entity.
+        void UpdateTileTexture(const TerrainData::Tile& tile, TileEntity& tileEntity) const;
 
-        Wrappers::RglMesh m_rglMesh = Wrappers::RglMesh::CreateInvalid();
-        Wrappers::RglEntity m_rglEntity = Wrappers::RglEntity::CreateInvalid();
+        AZStd::unordered_map<TerrainData::TileKey, TileEntity> m_tileEntities;
         Wrappers::RglTexture m_rglTexture = Wrappers::RglTexture::CreateInvalid();
 
         TerrainData m_terrainData;
+        AZStd::vector<TerrainData::TileKey> m_updatedTiles; //!< Cached to avoid reallocation on each update.
+        //! Staging buffers for the tile geometry of created meshes. Cached to avoid reallocation on each mesh creation.
+        //! Vertex updates and UVs are collected into pooled buffers instead, since they are handed over to RGL commands.
+        AZStd::vector<rgl_vec3f> m_stagingVertices;
+        AZStd::vector<rgl_vec3i> m_stagingIndices;
 
         int32_t m_packedRglEntityId;
     };
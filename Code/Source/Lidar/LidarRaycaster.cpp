@@ -12,15 +12,62 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include <AzCore/Component/TickBus.h>
+#include <AzCore/std/sort.h>
 #include <Lidar/LidarRaycaster.h>
 #include <Lidar/LidarSystemNotificationBus.h>
 #include <RGL/RGLBus.h>
 #include <ROS2/ROS2Bus.h>
 #include <Utilities/RGLUtils.h>
+#include <Utilities/RglExecutor.h>
 #include <rgl/api/extensions/ros2.h>
 
 namespace RGL
 {
+    namespace
+    {
+        //! Returns the smallest non-zero difference between the provided angles or zero if all angles are the same.
+        float CalculateMinAngleDifference(AZStd::vector<float>& angles)
+        {
+            static constexpr float AngleTolerance = 1.0e-5f;
+
+            AZStd::sort(angles.begin(), angles.end());
+            float minDifference = 0.0f;
+            for (size_t i = 1U; i < angles.size(); ++i)
+            {
+                const float difference = angles[i] - angles[i - 1U];
+                if (difference > AngleTolerance && (minDifference == 0.0f || difference < minDifference))
+                {
+                    minDifference = difference;
+                }
+            }
+
+            return minDifference;
+        }
+
+        //! Estimates the angular resolution of a lidar as the smallest yaw or pitch difference between its rays.
+        float CalculateAngularResolution(const AZStd::vector<AZ::Vector3>& orientations)
+        {
+            AZStd::vector<float> pitches, yaws;
+            pitches.reserve(orientations.size());
+            yaws.reserve(orientations.size());
+            for (const AZ::Vector3& orientation : orientations)
+            {
+                pitches.push_back(orientation.GetY());
+                yaws.push_back(orientation.GetZ());
+            }
+
+            const float pitchResolution = CalculateMinAngleDifference(pitches);
+            const float yawResolution = CalculateMinAngleDifference(yaws);
+            if (pitchResolution == 0.0f || yawResolution == 0.0f)
+            {
+                return AZStd::max(pitchResolution, yawResolution);
+            }
+
+            return AZStd::min(pitchResolution, yawResolution);
+        }
+    } // namespace
+
     LidarRaycaster::LidarRaycaster(const AZ::Uuid& uuid)
         : m_uuid{ uuid }
     {
@@ -32,6 +79,10 @@ namespace RGL
         : m_uuid{ other.m_uuid }
         , m_isMaxRangeEnabled{ other.m_isMaxRangeEnabled }
         , m_range{ other.m_range }
+        , m_lastLidarPosition{ other.m_lastLidarPosition }
+        , m_angularResolution{ other.m_angularResolution }
+        , m_lastRaycastTime{ other.m_lastRaycastTime }
+        , m_raycastInterval{ other.m_raycastInterval }
         , m_graph{ std::move(other.m_graph) }
         , m_rayTransforms{ AZStd::move(other.m_rayTransforms) }
         , m_rglRaycastResults{ AZStd::move(other.m_rglRaycastResults) }
@@ -52,6 +103,34 @@ namespace RGL
         }
     }
 
+    void LidarRaycaster::CollectMemoryUsage(MemoryUsageReport& report) const
+    {
+        report.m_other[AZStd::string::format("Lidar %s", m_uuid.ToString<AZStd::string>().c_str())] += m_graph.GetMemoryUsage();
+    }
+
+    AZStd::optional<LidarVolume> LidarRaycaster::GetLidarVolume() const
+    {
+        if (!m_lastLidarPosition.has_value() || !m_range.has_value())
+        {
+            return AZStd::nullopt;
+        }
+
+        return LidarVolume{ m_lastLidarPosition.value(), m_range->m_max, m_angularResolution };
+    }
+
+    bool LidarRaycaster::IsRaycastDue(double time, double tickDuration) const
+    {
+        if (m_raycastInterval <= 0.0)
+        {
+            return false;
+        }
+
+        // A lidar which missed its predicted raycast by more than an interval is assumed to have stopped raycasting,
+        // so the prediction expires instead of staying true in every following tick.
+        const double nextRaycastTime = m_lastRaycastTime + m_raycastInterval;
+        return nextRaycastTime <= time + 0.5 * tickDuration && time - 0.5 * tickDuration <= nextRaycastTime + m_raycastInterval;
+    }
+
     void LidarRaycaster::ConfigureRayOrientations(const AZStd::vector<AZ::Vector3>& orientations)
     {
         ValidateRayOrientations(orientations);
@@ -76,7 +155,12 @@ namespace RGL
             m_rayTransforms.push_back(Utils::AzMatrix3x4FromRglMat3x4(transform));
         }
 
-        m_graph.ConfigureRayPosesNode(rglRayTransforms);
+        Utils::ExecuteRglCommand(
+            [this, &rglRayTransforms]()
+            {
+                m_graph.ConfigureRayPosesNode(rglRayTransforms);
+            });
+        m_angularResolution = CalculateAngularResolution(orientations);
     }
 
     void LidarRaycaster::ConfigureRayRange(ROS2Sensors::RayRange range)
@@ -85,7 +169,11 @@ namespace RGL
 
         UpdateNonHitValues();
 
-        m_graph.ConfigureRayRangesNode(range.m_min, range.m_max);
+        Utils::ExecuteRglCommand(
+            [this, range]()
+            {
+                m_graph.ConfigureRayRangesNode(range.m_min, range.m_max);
+            });
     }
 
     void LidarRaycaster::ConfigureRaycastResultFlags(ROS2Sensors::RaycastResultFlags flags)
@@ -116,30 +204,52 @@ namespace RGL
             m_rglRaycastResults.m_fields.push_back(RGL_FIELD_ENTITY_ID_I32);
         }
 
-        m_graph.ConfigureYieldNodes(m_rglRaycastResults.m_fields.data(), m_rglRaycastResults.m_fields.size());
+        Utils::ExecuteRglCommand(
+            [this]()
+            {
+                m_graph.ConfigureYieldNodes(m_rglRaycastResults.m_fields.data(), m_rglRaycastResults.m_fields.size());
 
-        m_graph.SetIsCompactEnabled(ShouldEnableCompact());
-        m_graph.SetIsPcPublishingEnabled(ShouldEnablePcPublishing());
+                m_graph.SetIsCompactEnabled(ShouldEnableCompact());
+                m_graph.SetIsPcPublishingEnabled(ShouldEnablePcPublishing());
+            });
     }
 
     AZ::Outcome<ROS2Sensors::RaycastResults, const char*> LidarRaycaster::PerformRaycast(const AZ::Transform& lidarTransform)
     {
         AZ_Assert(m_range.has_value(), "Programmer error. Raycaster range is not fully configured.");
         AZ_Assert(m_raycastResults.has_value(), "Programmer error. Raycaster result fields not fully configured.");
-        RGLInterface::Get()->UpdateScene();
 
-        const AZ::Matrix3x4 lidarPose = AZ::Matrix3x4::CreateFromTransform(lidarTransform);
-
-        m_graph.ConfigureLidarTransformNode(lidarPose);
-        if (m_graph.IsPcPublishingEnabled())
+        AZ::ScriptTimePoint currentTime;
+        AZ::TickRequestBus::BroadcastResult(currentTime, &AZ::TickRequestBus::Events::GetTimeAtCurrentTick);
+        if (m_lastRaycastTime >= 0.0 && currentTime.GetSeconds() > m_lastRaycastTime)
         {
-            // Transforms the obtained point-cloud from world to sensor frame of reference.
-            m_graph.ConfigurePcTransformNode(lidarPose.GetInverseFull());
+            m_raycastInterval = currentTime.GetSeconds() - m_lastRaycastTime;
         }
+        m_lastRaycastTime = currentTime.GetSeconds();
+
+        // The position has to be known before the scene update, since it determines which geometry is present in the scene.
+        // If the raycast was predicted, the scene was already updated earlier in the tick and the call has no effect.
+        m_lastLidarPosition = lidarTransform.GetTranslation();
+        RGLInterface::Get()->UpdateScene();
 
-        m_graph.Run();
+        const AZ::Matrix3x4 lidarPose = AZ::Matrix3x4::CreateFromTransform(lidarTransform);
 
-        if (!m_graph.GetResults(m_rglRaycastResults))
+        // Executed after the scene changes submitted by the scene update, since commands are executed in the submission order.
+        const bool areResultsFetched = Utils::ExecuteRglCommand(
+            [this, &lidarPose]()
+            {
+                m_graph.ConfigureLidarTransformNode(lidarPose);
+                if (m_graph.IsPcPublishingEnabled())
+                {
+                    // Transforms the obtained point-cloud from world to sensor frame of reference.
+                    m_graph.ConfigurePcTransformNode(lidarPose.GetInverseFull());
+                }
+
+                m_graph.Run();
+                return m_graph.GetResults(m_rglRaycastResults);
+            });
+
+        if (!areResultsFetched)
         {
             return AZ::Failure("Results returned by RGL did not match requested.");
         }
@@ -185,9 +295,13 @@ namespace RGL
     void LidarRaycaster::ConfigureNoiseParameters(
         float angularNoiseStdDev, float distanceNoiseStdDevBase, float distanceNoiseStdDevRisePerMeter)
     {
-        m_graph.ConfigureAngularNoiseNode(angularNoiseStdDev);
-        m_graph.ConfigureDistanceNoiseNode(distanceNoiseStdDevBase, distanceNoiseStdDevRisePerMeter);
-        m_graph.SetIsNoiseEnabled(true);
+        Utils::ExecuteRglCommand(
+            [this, angularNoiseStdDev, distanceNoiseStdDevBase, distanceNoiseStdDevRisePerMeter]()
+            {
+                m_graph.ConfigureAngularNoiseNode(angularNoiseStdDev);
+                m_graph.ConfigureDistanceNoiseNode(distanceNoiseStdDevBase, distanceNoiseStdDevRisePerMeter);
+                m_graph.SetIsNoiseEnabled(true);
+            });
     }
 
     void LidarRaycaster::ExcludeEntities(const AZStd::vector<AZ::EntityId>& excludedEntities)
@@ -209,7 +323,11 @@ namespace RGL
             maxRangeNonHitValue = m_range.value().m_max;
         }
 
-        m_graph.ConfigureRaytraceNodeNonHits(minRangeNonHitValue, maxRangeNonHitValue);
+        Utils::ExecuteRglCommand(
+            [this, minRangeNonHitValue, maxRangeNonHitValue]()
+            {
+                m_graph.ConfigureRaytraceNodeNonHits(minRangeNonHitValue, maxRangeNonHitValue);
+            });
     }
 
     void LidarRaycaster::ConfigureMaxRangePointAddition(bool addMaxRangePoints)
@@ -219,15 +337,23 @@ namespace RGL
         UpdateNonHitValues();
 
         // We need to configure if points should be compacted to minimize the CPU operations when retrieving raycast results.
-        m_graph.SetIsCompactEnabled(ShouldEnableCompact());
-        m_graph.SetIsPcPublishingEnabled(ShouldEnablePcPublishing());
+        Utils::ExecuteRglCommand(
+            [this]()
+            {
+                m_graph.SetIsCompactEnabled(ShouldEnableCompact());
+                m_graph.SetIsPcPublishingEnabled(ShouldEnablePcPublishing());
+            });
     }
 
     void LidarRaycaster::ConfigurePointCloudPublisher(
         const AZStd::string& topicName, const AZStd::string& frameId, const ROS2::QoS& qosPolicy)
     {
-        m_graph.ConfigurePcPublisherNode(topicName, frameId, qosPolicy);
-        m_graph.SetIsPcPublishingEnabled(ShouldEnablePcPublishing());
+        Utils::ExecuteRglCommand(
+            [this, &topicName, &frameId, &qosPolicy]()
+            {
+                m_graph.ConfigurePcPublisherNode(topicName, frameId, qosPolicy);
+                m_graph.SetIsPcPublishingEnabled(ShouldEnablePcPublishing());
+            });
     }
 
     bool LidarRaycaster::CanHandlePublishing()
@@ -287,7 +413,12 @@ namespace RGL
 
     void LidarRaycaster::UpdatePublisherTimestamp(AZ::u64 timestampNanoseconds)
     {
-        RGL_CHECK(rgl_scene_set_time(nullptr, timestampNanoseconds));
+        // Applied before the next raycast, since commands are executed in the submission order.
+        Utils::PostRglCommand(
+            [timestampNanoseconds]()
+            {
+                RGL_CHECK(rgl_scene_set_time(nullptr, timestampNanoseconds));
+            });
     }
 
     bool LidarRaycaster::ShouldEnableCompact() const
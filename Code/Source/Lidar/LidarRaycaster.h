@@ -14,6 +14,7 @@
  */
 #pragma once
 
+#include <Lidar/LidarVolume.h>
 #include <Lidar/PipelineGraph.h>
 #include <ROS2Sensors/Lidar/LidarRaycasterBus.h>
 #include <Utilities/RGLUtils.h>
@@ -29,6 +30,19 @@ namespace RGL
         LidarRaycaster(const LidarRaycaster& other) = delete;
         ~LidarRaycaster() override;
 
+        //! Adds the memory used by this lidar's RGL pipeline to the report.
+        void CollectMemoryUsage(MemoryUsageReport& report) const;
+
+        //! Returns the volume observed by this lidar.
+        //! The returned optional does not contain a value if the lidar has not performed any raycast yet.
+        [[nodiscard]] AZStd::optional<LidarVolume> GetLidarVolume() const;
+
+        //! Predicts whether the lidar raycasts in the tick starting at the provided time, based on the interval of its last raycasts.
+        //! The prediction expires one interval after the predicted raycast time, if the lidar stopped raycasting.
+        //! @param time Time of the tick (in seconds).
+        //! @param tickDuration Duration of the tick (in seconds), used as a tolerance for the tick-aligned raycast times.
+        [[nodiscard]] bool IsRaycastDue(double time, double tickDuration) const;
+
     protected:
         // LidarRaycasterRequestBus overrides
         void ConfigureRayOrientations(const AZStd::vector<AZ::Vector3>& orientations) override;
@@ -65,6 +79,10 @@ namespace RGL
         bool m_isMaxRangeEnabled{ false }; //!< Determines whether max range point addition is enabled.
 
         AZStd::optional<ROS2Sensors::RayRange> m_range{};
+        AZStd::optional<AZ::Vector3> m_lastLidarPosition{}; //!< Lidar position during the last raycast.
+        float m_angularResolution{ 0.0f }; //!< Smallest angle between neighboring rays (in radians). Zero if unknown.
+        double m_lastRaycastTime{ -1.0 }; //!< Time of the tick of the last raycast (in seconds). Negative if no raycast was performed.
+        double m_raycastInterval{ 0.0 }; //!< Time between the ticks of the last two raycasts (in seconds). Zero if unknown.
         AZStd::vector<AZ::Matrix3x4> m_rayTransforms{ AZ::Matrix3x4::CreateIdentity() };
 
         PipelineGraph::RaycastResults m_rglRaycastResults;
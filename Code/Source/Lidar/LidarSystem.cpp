@@ -50,6 +50,38 @@ namespace RGL
         m_lidars.clear();
     }
 
+    void LidarSystem::CollectMemoryUsage(MemoryUsageReport& report) const
+    {
+        for (const auto& [lidarId, lidar] : m_lidars)
+        {
+            lidar.CollectMemoryUsage(report);
+        }
+    }
+
+    void LidarSystem::CollectLidarVolumes(AZStd::vector<LidarVolume>& lidarVolumes) const
+    {
+        for (const auto& [lidarId, lidar] : m_lidars)
+        {
+            if (const AZStd::optional<LidarVolume> lidarVolume = lidar.GetLidarVolume(); lidarVolume.has_value())
+            {
+                lidarVolumes.push_back(lidarVolume.value());
+            }
+        }
+    }
+
+    bool LidarSystem::IsRaycastDue(double time, double tickDuration) const
+    {
+        for (const auto& [lidarId, lidar] : m_lidars)
+        {
+            if (lidar.IsRaycastDue(time, tickDuration))
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
     ROS2Sensors::LidarId LidarSystem::CreateLidar(AZ::EntityId lidarEntityId)
     {
         const AZ::Uuid lidarUuid = AZ::Uuid::CreateRandom();
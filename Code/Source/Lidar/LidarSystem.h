@@ -33,6 +33,16 @@ namespace RGL
         //! Deletes all lidar raycasters created by this system.
         void Clear();
 
+        //! Adds the memory used by pipelines of all lidar raycasters to the report.
+        void CollectMemoryUsage(MemoryUsageReport& report) const;
+
+        //! Collects volumes observed by all lidar raycasters which already performed a raycast.
+        void CollectLidarVolumes(AZStd::vector<LidarVolume>& lidarVolumes) const;
+
+        //! Returns true if any lidar raycaster is predicted to raycast in the tick starting at the provided time.
+        //! @see LidarRaycaster::IsRaycastDue
+        [[nodiscard]] bool IsRaycastDue(double time, double tickDuration) const;
+
     protected:
         // LidarSystemRequestBus overrides
         ROS2Sensors::LidarId CreateLidar(AZ::EntityId lidarEntityId) override;
@@ -16,6 +16,8 @@
 
 #include <AzCore/Component/EntityId.h>
 #include <AzCore/EBus/EBus.h>
+#include <AzCore/std/containers/vector.h>
+#include <Lidar/LidarVolume.h>
 
 namespace RGL
 {
@@ -37,6 +39,11 @@ namespace RGL
         virtual void OnLidarDestroyed()
         {
         }
+
+        //! Called on each scene update with the volumes observed by the lidars which already performed a raycast.
+        virtual void OnLidarVolumesUpdated([[maybe_unused]] const AZStd::vector<LidarVolume>& lidarVolumes)
+        {
+        }
         //////////////////////////////////////////////////////////////////////////
     };
     using LidarSystemNotificationBus = AZ::EBus<LidarSystemNotifications>;
@@ -0,0 +1,28 @@
+/* Copyright 2024, Robotec.ai sp. z o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <AzCore/Math/Vector3.h>
+
+namespace RGL
+{
+    //! Describes the space observed by an active lidar during its last raycast.
+    struct LidarVolume
+    {
+        AZ::Vector3 m_position{ AZ::Vector3::CreateZero() };
+        float m_maxRange{ 0.0f };
+        float m_angularResolution{ 0.0f }; //!< Smallest angle (in radians) between neighboring rays. Zero if unknown.
+    };
+} // namespace RGL
@@ -14,36 +14,44 @@
  */
 #include <Lidar/PipelineGraph.h>
 #include <Utilities/RGLUtils.h>
+#include <Utilities/RglExecutor.h>
 #include <rgl/api/extensions/ros2.h>
 
 namespace RGL
 {
     PipelineGraph::PipelineGraph()
     {
-        ConfigureRayPosesNode({ Utils::IdentityTransform });
-        ConfigureRayRangesNode(0.0f, 1.0f);
-        ConfigureLidarTransformNode(AZ::Matrix3x4::CreateIdentity());
-        RGL_CHECK(rgl_node_raytrace(&m_nodes.m_rayTrace, nullptr));
-        RGL_CHECK(rgl_node_points_compact_by_field(&m_nodes.m_pointsCompact, RGL_FIELD_IS_HIT_I32));
-        ConfigureAngularNoiseNode(0.0f);
-        ConfigureDistanceNoiseNode(0.0f, 0.0f);
-        ConfigureYieldNodes(DefaultFields.data(), DefaultFields.size());
-
-        ConfigurePcTransformNode(AZ::Matrix3x4::CreateIdentity());
-        RGL_CHECK(rgl_node_points_format(&m_nodes.m_pcPublishFormat, DefaultFields.data(), aznumeric_cast<int32_t>(DefaultFields.size())));
-
-        // Non-conditional connections
-        RGL_CHECK(rgl_graph_node_add_child(m_nodes.m_rayPoses, m_nodes.m_rayRanges));
-        RGL_CHECK(rgl_graph_node_add_child(m_nodes.m_rayRanges, m_nodes.m_lidarTransform));
-        RGL_CHECK(rgl_graph_node_add_child(m_nodes.m_compactYield, m_nodes.m_pointsYield));
-        RGL_CHECK(rgl_graph_node_add_child(m_nodes.m_pointCloudTransform, m_nodes.m_pcPublishFormat));
-
-        InitializeConditionalConnections();
+        Utils::ExecuteRglCommand(
+            [this]()
+            {
+                ConfigureRayPosesNode({ Utils::IdentityTransform });
+                ConfigureRayRangesNode(0.0f, 1.0f);
+                ConfigureLidarTransformNode(AZ::Matrix3x4::CreateIdentity());
+                RGL_CHECK(rgl_node_raytrace(&m_nodes.m_rayTrace, nullptr));
+                RGL_CHECK(rgl_node_points_compact_by_field(&m_nodes.m_pointsCompact, RGL_FIELD_IS_HIT_I32));
+                ConfigureAngularNoiseNode(0.0f);
+                ConfigureDistanceNoiseNode(0.0f, 0.0f);
+                ConfigureYieldNodes(DefaultFields.data(), DefaultFields.size());
+
+                ConfigurePcTransformNode(AZ::Matrix3x4::CreateIdentity());
+                RGL_CHECK(rgl_node_points_format(
+                    &m_nodes.m_pcPublishFormat, DefaultFields.data(), aznumeric_cast<int32_t>(DefaultFields.size())));
+
+                // Non-conditional connections
+                RGL_CHECK(rgl_graph_node_add_child(m_nodes.m_rayPoses, m_nodes.m_rayRanges));
+                RGL_CHECK(rgl_graph_node_add_child(m_nodes.m_rayRanges, m_nodes.m_lidarTransform));
+                RGL_CHECK(rgl_graph_node_add_child(m_nodes.m_compactYield, m_nodes.m_pointsYield));
+                RGL_CHECK(rgl_graph_node_add_child(m_nodes.m_pointCloudTransform, m_nodes.m_pcPublishFormat));
+
+                InitializeConditionalConnections();
+            });
     }
 
     PipelineGraph::PipelineGraph(PipelineGraph&& other)
         : m_nodes{ other.m_nodes }
         , m_activeFeatures{ other.m_activeFeatures }
+        , m_rayCount{ other.m_rayCount }
+        , m_pointSize{ other.m_pointSize }
         , m_conditionalConnections(std::move(other.m_conditionalConnections))
     {
         other.m_nodes = {};
@@ -57,20 +65,24 @@ namespace RGL
             return;
         }
 
-        // We enable all the features we can to destroy the whole graph with
-        // one (or two) rgl_graph_destroy API call(s).
-        SetIsNoiseEnabled(true);
-        SetIsCompactEnabled(true);
-        if (IsPublisherConfigured())
-        {
-            SetIsPcPublishingEnabled(true);
-        }
-        else
-        {
-            rgl_graph_destroy(m_nodes.m_pointCloudTransform);
-        }
-
-        rgl_graph_destroy(m_nodes.m_rayPoses);
+        Utils::ExecuteRglCommand(
+            [this]()
+            {
+                // We enable all the features we can to destroy the whole graph with
+                // one (or two) rgl_graph_destroy API call(s).
+                SetIsNoiseEnabled(true);
+                SetIsCompactEnabled(true);
+                if (IsPublisherConfigured())
+                {
+                    SetIsPcPublishingEnabled(true);
+                }
+                else
+                {
+                    rgl_graph_destroy(m_nodes.m_pointCloudTransform);
+                }
+
+                rgl_graph_destroy(m_nodes.m_rayPoses);
+            });
     }
 
     bool PipelineGraph::IsCompactEnabled() const
@@ -89,6 +101,7 @@ namespace RGL
     void PipelineGraph::ConfigureRayPosesNode(const AZStd::vector<rgl_mat3x4f>& rayPoses)
     {
         RGL_CHECK(rgl_node_rays_from_mat3x4f(&m_nodes.m_rayPoses, rayPoses.data(), aznumeric_cast<int32_t>(rayPoses.size())));
+        m_rayCount = rayPoses.size();
     }
 
     void PipelineGraph::ConfigureRayRangesNode(float min, float max)
@@ -102,6 +115,12 @@ namespace RGL
         RGL_CHECK(rgl_node_points_yield(&m_nodes.m_pointsYield, fields, aznumeric_cast<int32_t>(size)));
         RGL_CHECK(rgl_node_points_yield(&m_nodes.m_rayTraceYield, fields, aznumeric_cast<int32_t>(size)));
         RGL_CHECK(rgl_node_points_yield(&m_nodes.m_compactYield, fields, aznumeric_cast<int32_t>(size)));
+
+        m_pointSize = 0U;
+        for (size_t fieldIdx = 0U; fieldIdx < size; ++fieldIdx)
+        {
+            m_pointSize += GetFieldSize(fields[fieldIdx]);
+        }
     }
 
     void PipelineGraph::ConfigureLidarTransformNode(const AZ::Matrix3x4& lidarTransform)
@@ -207,6 +226,35 @@ namespace RGL
         return success;
     }
 
+    MemoryUsage PipelineGraph::GetMemoryUsage() const
+    {
+        // Each of the yield nodes (ray trace, compact and points) holds its own copy of the yielded fields.
+        static constexpr size_t YieldNodeCount = 3U;
+
+        MemoryUsage usage;
+        usage.m_rayPoseBytes = m_rayCount * sizeof(rgl_mat3x4f);
+        usage.m_resultBytes = m_rayCount * m_pointSize * YieldNodeCount;
+        return usage;
+    }
+
+    size_t PipelineGraph::GetFieldSize(rgl_field_t field)
+    {
+        switch (field)
+        {
+        case RGL_FIELD_XYZ_VEC3_F32:
+            return sizeof(rgl_vec3f);
+        case RGL_FIELD_IS_HIT_I32:
+        case RGL_FIELD_ENTITY_ID_I32:
+            return sizeof(int32_t);
+        case RGL_FIELD_DISTANCE_F32:
+        case RGL_FIELD_INTENSITY_F32:
+            return sizeof(float);
+        default:
+            AZ_Assert(false, "Unknown size of the result field type!");
+            return 0U;
+        }
+    }
+
     bool PipelineGraph::IsFeatureEnabled(PipelineGraph::PipelineFeatureFlags feature) const
     {
         return m_activeFeatures & feature;
@@ -16,6 +16,7 @@
 
 #include <AzCore/Math/Matrix3x3.h>
 #include <AzCore/std/containers/array.h>
+#include <RGL/MemoryUsageBus.h>
 #include <ROS2/Communication/QoS.h>
 #include <Utilities/RGLUtils.h>
 #include <rgl/api/core.h>
@@ -25,6 +26,7 @@ namespace RGL
     //! Class that manages the RGL pipeline graph construction, which depends on
     //! three conditions: point-cloud compact, noise and publication. The diagram
     //! representation of this graph can be found under static/PipelineGraph.mmd.
+    //! The graph is created and destroyed on the RGL executor thread. Other methods have to be called from RGL commands.
     class PipelineGraph
     {
     private:
@@ -82,6 +84,9 @@ namespace RGL
         //! @return If successful returns true, otherwise returns false.
         bool GetResults(RaycastResults& results) const;
 
+        //! Returns the number of bytes used by the ray poses and by the per-ray result buffers of the graph.
+        [[nodiscard]] MemoryUsage GetMemoryUsage() const;
+
     private:
         enum PipelineFeatureFlags : uint8_t
         // clang-format off
@@ -110,6 +115,8 @@ namespace RGL
 
         [[nodiscard]] bool IsFeatureEnabled(PipelineFeatureFlags feature) const;
 
+        static size_t GetFieldSize(rgl_field_t field);
+
         //! Get a raycast result of specified field.
         //! @param result Raycast field result vector.
         //! @param rglFieldType Enum value representing the field type.
@@ -143,6 +150,8 @@ namespace RGL
 
         PipelineFeatureFlags m_activeFeatures{ PointsCompact };
         Nodes m_nodes;
+        size_t m_rayCount{ 0U };
+        size_t m_pointSize{ 0U }; //!< Size of all yielded fields of a single point.
         std::vector<ConditionalConnection> m_conditionalConnections;
     };
 } // namespace RGL
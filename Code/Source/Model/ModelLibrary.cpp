@@ -30,7 +30,17 @@ namespace RGL
 
     ModelLibrary::ModelLibrary(ModelLibrary&& modelLibrary)
         : m_meshMap{ AZStd::move(modelLibrary.m_meshMap) }
+        , m_actorMeshMap{ AZStd::move(modelLibrary.m_actorMeshMap) }
+        , m_rigidActorMeshMap{ AZStd::move(modelLibrary.m_rigidActorMeshMap) }
         , m_textureMap{ AZStd::move(modelLibrary.m_textureMap) }
+        , m_imageTextureMap{ AZStd::move(modelLibrary.m_imageTextureMap) }
+        , m_placeholderTextureMap{ AZStd::move(modelLibrary.m_placeholderTextureMap) }
+        , m_pendingPlaceholderTextures{ AZStd::move(modelLibrary.m_pendingPlaceholderTextures) }
+        , m_materialImageIds{ AZStd::move(modelLibrary.m_materialImageIds) }
+        , m_pendingImageMaterials{ AZStd::move(modelLibrary.m_pendingImageMaterials) }
+        , m_failedImageIds{ AZStd::move(modelLibrary.m_failedImageIds) }
+        , m_textureLoader{ AZStd::move(modelLibrary.m_textureLoader) }
+        , m_textureConfig{ modelLibrary.m_textureConfig }
         , m_invalidTexture(AZStd::move(modelLibrary.m_invalidTexture))
     {
         modelLibrary.BusDisconnect();
@@ -52,20 +62,134 @@ namespace RGL
     void ModelLibrary::Clear()
     {
         m_meshMap.clear();
+        m_actorMeshMap.clear();
+        m_rigidActorMeshMap.clear();
+        ClearTextures();
+    }
+
+    void ModelLibrary::ClearTextures()
+    {
+        m_textureLoader.Clear();
         m_textureMap.clear();
+        m_imageTextureMap.clear();
+        m_placeholderTextureMap.clear();
+        m_pendingPlaceholderTextures.clear();
+        m_materialImageIds.clear();
+        m_pendingImageMaterials.clear();
+        m_failedImageIds.clear();
+    }
+
+    void ModelLibrary::SetTextureConfiguration(const MaterialTextureConfiguration& config)
+    {
+        m_textureConfig = config;
     }
 
-    const MeshMaterialSlotPairList& ModelLibrary::StoreModelAsset(const AZ::Data::Asset<AZ::RPI::ModelAsset>& modelAsset)
+    void ModelLibrary::Update()
     {
-        const AZ::Data::AssetId& assetId = modelAsset.GetId();
-        if (auto meshPointersIt = m_meshMap.find(assetId); meshPointersIt != m_meshMap.end())
+        if (m_textureLoader.IsEmpty())
         {
-            return meshPointersIt->second;
+            return;
+        }
+
+        m_loadedTextures.clear();
+        m_textureLoader.Update(m_loadedTextures);
+        for (auto& [imageAssetId, texture] : m_loadedTextures)
+        {
+            const auto pendingIt = m_pendingImageMaterials.find(imageAssetId);
+            if (pendingIt == m_pendingImageMaterials.end())
+            {
+                continue;
+            }
+
+            // Materials keep using their placeholders if the texture failed to be created.
+            const Wrappers::RglTexture* storedTexture = nullptr;
+            if (texture.IsValid())
+            {
+                storedTexture = &m_imageTextureMap.emplace(imageAssetId, AZStd::move(texture)).first->second;
+            }
+            else
+            {
+                m_failedImageIds.insert(imageAssetId);
+            }
+
+            for (const AZ::Data::AssetId& materialAssetId : pendingIt->second)
+            {
+                const auto placeholderIt = m_placeholderTextureMap.find(materialAssetId);
+                if (placeholderIt == m_placeholderTextureMap.end())
+                {
+                    continue;
+                }
+
+                const Wrappers::RglTexture* placeholder = &placeholderIt->second;
+                m_pendingPlaceholderTextures.erase(placeholder);
+                if (storedTexture)
+                {
+                    ModelLibraryNotificationBus::Event(
+                        placeholder, &ModelLibraryNotifications::OnMaterialTextureReady, *placeholder, *storedTexture);
+                }
+            }
+            m_pendingImageMaterials.erase(pendingIt);
+        }
+        m_loadedTextures.clear();
+    }
+
+    void ModelLibrary::CollectMemoryUsage(MemoryUsageReport& report) const
+    {
+        for (const auto& [assetId, lodMeshes] : m_meshMap)
+        {
+            MemoryUsage& assetUsage = report.m_assets[assetId];
+            for (const auto& [lodIndex, meshes] : lodMeshes)
+            {
+                for (const auto& [mesh, materialSlot] : meshes)
+                {
+                    assetUsage += mesh.GetMemoryUsage();
+                }
+            }
+        }
+
+        for (const ActorMeshMap* actorMeshMap : { &m_actorMeshMap, &m_rigidActorMeshMap })
+        {
+            for (const auto& [assetId, lodMeshes] : *actorMeshMap)
+            {
+                MemoryUsage& assetUsage = report.m_assets[assetId];
+                for (const auto& [lodIndex, meshes] : lodMeshes)
+                {
+                    for (const Wrappers::RglMesh& mesh : meshes.m_meshes)
+                    {
+                        assetUsage += mesh.GetMemoryUsage();
+                    }
+                }
+            }
+        }
+
+        for (const auto& [assetId, texture] : m_textureMap)
+        {
+            report.m_assets[assetId] += texture.GetMemoryUsage();
+        }
+
+        for (const auto& [assetId, texture] : m_imageTextureMap)
+        {
+            report.m_assets[assetId] += texture.GetMemoryUsage();
+        }
+
+        for (const auto& [assetId, texture] : m_placeholderTextureMap)
+        {
+            report.m_assets[assetId] += texture.GetMemoryUsage();
         }
+    }
 
+    const MeshMaterialSlotPairList& ModelLibrary::StoreModelAsset(const AZ::Data::Asset<AZ::RPI::ModelAsset>& modelAsset, size_t lodIndex)
+    {
         const auto lodAssets = modelAsset->GetLodAssets();
-        // Get Highest LOD
-        const auto modelLodAsset = lodAssets.begin()->Get();
+        lodIndex = AZStd::min(lodIndex, lodAssets.size() - 1U);
+
+        LodMeshMap& lodMeshes = m_meshMap[modelAsset.GetId()];
+        if (auto meshPointersIt = lodMeshes.find(lodIndex); meshPointersIt != lodMeshes.end())
+        {
+            return meshPointersIt->second;
+        }
+
+        const auto modelLodAsset = lodAssets[lodIndex].Get();
         const auto meshes = modelLodAsset->GetMeshes();
 
         MeshMaterialSlotPairList modelMeshes;
@@ -75,20 +199,40 @@ namespace RGL
             const AZStd::span<const rgl_vec3f> vertices = mesh.GetSemanticBufferTyped<rgl_vec3f>(AZ::Name("POSITION"));
             const AZStd::span<const rgl_vec3i> indices = mesh.GetIndexBufferTyped<rgl_vec3i>();
 
+            // Invalid meshes are stored as well to keep the indices consistent with the model LOD meshes.
             Wrappers::RglMesh rglMesh(vertices.data(), vertices.size(), indices.data(), indices.size());
-            if (!rglMesh.IsValid())
+            if (rglMesh.IsValid())
             {
-                continue;
+                const AZStd::span<const rgl_vec2f> uvs = mesh.GetSemanticBufferTyped<rgl_vec2f>(AZ::Name("UV"));
+                rglMesh.SetTextureCoordinates(uvs.data(), uvs.size());
             }
 
-            const AZStd::span<const rgl_vec2f> uvs = mesh.GetSemanticBufferTyped<rgl_vec2f>(AZ::Name("UV"));
-            rglMesh.SetTextureCoordinates(uvs.data(), uvs.size());
-
             const AZ::RPI::ModelMaterialSlot& slot = modelAsset->FindMaterialSlot(mesh.GetMaterialSlotId());
             modelMeshes.emplace_back(AZStd::move(rglMesh), slot);
         }
 
-        return m_meshMap.emplace(assetId, AZStd::move(modelMeshes)).first->second;
+        return lodMeshes.emplace(lodIndex, AZStd::move(modelMeshes)).first->second;
+    }
+
+    const ActorMeshList* ModelLibrary::FindActorMeshes(const AZ::Data::AssetId& actorAssetId, size_t lodIndex, bool areJointsRigid) const
+    {
+        const ActorMeshMap& actorMeshMap = areJointsRigid ? m_rigidActorMeshMap : m_actorMeshMap;
+        const auto lodMeshesIt = actorMeshMap.find(actorAssetId);
+        if (lodMeshesIt == actorMeshMap.end())
+        {
+            return nullptr;
+        }
+
+        const auto meshesIt = lodMeshesIt->second.find(lodIndex);
+        return meshesIt != lodMeshesIt->second.end() ? &meshesIt->second : nullptr;
+    }
+
+    const ActorMeshList& ModelLibrary::StoreActorMeshes(
+        const AZ::Data::AssetId& actorAssetId, size_t lodIndex, bool areJointsRigid, ActorMeshList&& meshes)
+    {
+        ActorMeshMap& actorMeshMap = areJointsRigid ? m_rigidActorMeshMap : m_actorMeshMap;
+        // Meshes stored before are kept, since they may already be used by other instances.
+        return actorMeshMap[actorAssetId].emplace(lodIndex, AZStd::move(meshes)).first->second;
     }
 
     const Wrappers::RglTexture& ModelLibrary::StoreMaterialAsset(const AZ::Data::Asset<AZ::RPI::MaterialAsset>& materialAsset)
@@ -99,12 +243,62 @@ namespace RGL
             return textureIt->second;
         }
 
-        Wrappers::RglTexture materialTexture = AZStd::move(Wrappers::RglTexture::CreateFromMaterialAsset(materialAsset));
-        if (materialTexture.IsValid())
+        if (auto materialImageIt = m_materialImageIds.find(assetId); materialImageIt != m_materialImageIds.end())
         {
-            return m_textureMap.emplace(assetId, AZStd::move(materialTexture)).first->second;
+            if (auto imageTextureIt = m_imageTextureMap.find(materialImageIt->second); imageTextureIt != m_imageTextureMap.end())
+            {
+                return imageTextureIt->second;
+            }
+
+            // The placeholder is also kept if the image texture failed to be created.
+            return m_placeholderTextureMap.at(assetId);
+        }
+
+        const AZ::Data::AssetId imageAssetId = Wrappers::RglTexture::FindBaseColorImageAssetId(materialAsset);
+        if (imageAssetId.IsValid() && !m_failedImageIds.contains(imageAssetId))
+        {
+            m_materialImageIds.emplace(assetId, imageAssetId);
+            if (auto imageTextureIt = m_imageTextureMap.find(imageAssetId); imageTextureIt != m_imageTextureMap.end())
+            {
+                return imageTextureIt->second;
+            }
+
+            // Each image is loaded only once, regardless of the number of materials using it.
+            AZStd::vector<AZ::Data::AssetId>& pendingMaterials = m_pendingImageMaterials[imageAssetId];
+            if (pendingMaterials.empty())
+            {
+                m_textureLoader.Load(imageAssetId, m_textureConfig);
+            }
+            pendingMaterials.push_back(assetId);
+
+            // The image is decoded in the background, so the base color factor is used until then.
+            Wrappers::RglTexture placeholder = Wrappers::RglTexture::CreateFromMaterialColor(materialAsset);
+            if (!placeholder.IsValid())
+            {
+                placeholder = Wrappers::RglTexture::CreateFromFactor(DefaultIntensityFactor);
+            }
+
+            const Wrappers::RglTexture& storedPlaceholder =
+                m_placeholderTextureMap.emplace(assetId, AZStd::move(placeholder)).first->second;
+            m_pendingPlaceholderTextures.insert(&storedPlaceholder);
+            return storedPlaceholder;
+        }
+
+        if (Wrappers::RglTexture colorTexture = Wrappers::RglTexture::CreateFromMaterialColor(materialAsset); colorTexture.IsValid())
+        {
+            return m_textureMap.emplace(assetId, AZStd::move(colorTexture)).first->second;
         }
 
+        AZ_Error(
+            __func__,
+            false,
+            "Unable to find specular color and texture properties of material asset with ID: %s.",
+            assetId.ToString<AZStd::string>().c_str());
         return m_invalidTexture;
     }
+
+    bool ModelLibrary::IsPlaceholderTexture(const Wrappers::RglTexture& texture) const
+    {
+        return m_pendingPlaceholderTextures.contains(&texture);
+    }
 } // namespace RGL
@@ -16,7 +16,11 @@
 
 #include <AzCore/Asset/AssetCommon.h>
 #include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/unordered_set.h>
 #include <Model/ModelLibraryBus.h>
+#include <Model/TextureLoader.h>
+#include <RGL/MemoryUsageBus.h>
+#include <RGL/SceneConfiguration.h>
 #include <Wrappers/RglMesh.h>
 #include <Wrappers/RglTexture.h>
 #include <rgl/api/core.h>
@@ -35,18 +39,63 @@ namespace RGL
 
         //! Deletes all meshes and textures stored by the Library.
         void Clear();
+        //! Deletes all textures stored by the Library. Meshes are kept.
+        void ClearTextures();
+
+        //! Sets the configuration of textures created from material images.
+        //! Applies only to textures created afterwards, so the textures should be cleared after changing it.
+        void SetTextureConfiguration(const MaterialTextureConfiguration& config);
+
+        //! Stores material textures created in the background since the last update
+        //! and notifies the users of their placeholders. Has to be called from the main thread.
+        void Update();
+
+        //! Adds the memory used by the stored meshes and textures to the report.
+        //! The memory is attributed to the model, material and image assets the data was created from.
+        void CollectMemoryUsage(MemoryUsageReport& report) const;
 
     protected:
         // ModelLibraryRequestBus overrides
-        const MeshMaterialSlotPairList& StoreModelAsset(const AZ::Data::Asset<AZ::RPI::ModelAsset>& modelAsset) override;
+        const MeshMaterialSlotPairList& StoreModelAsset(const AZ::Data::Asset<AZ::RPI::ModelAsset>& modelAsset, size_t lodIndex) override;
         const Wrappers::RglTexture& StoreMaterialAsset(const AZ::Data::Asset<AZ::RPI::MaterialAsset>& materialAsset) override;
+        bool IsPlaceholderTexture(const Wrappers::RglTexture& texture) const override;
+        const ActorMeshList* FindActorMeshes(const AZ::Data::AssetId& actorAssetId, size_t lodIndex, bool areJointsRigid) const override;
+        const ActorMeshList& StoreActorMeshes(
+            const AZ::Data::AssetId& actorAssetId, size_t lodIndex, bool areJointsRigid, ActorMeshList&& meshes) override;
         Wrappers::RglTexture m_invalidTexture{ AZStd::move(Wrappers::RglTexture::CreateInvalid()) };
 
     private:
-        using MeshMap = AZStd::unordered_map<AZ::Data::AssetId, MeshMaterialSlotPairList>;
+        using LodMeshMap = AZStd::unordered_map<size_t, MeshMaterialSlotPairList>;
+        using MeshMap = AZStd::unordered_map<AZ::Data::AssetId, LodMeshMap>;
+        using ActorLodMeshMap = AZStd::unordered_map<size_t, ActorMeshList>;
+        using ActorMeshMap = AZStd::unordered_map<AZ::Data::AssetId, ActorLodMeshMap>;
         using TextureMap = AZStd::unordered_map<AZ::Data::AssetId, Wrappers::RglTexture>;
 
+        //! Intensity of placeholder textures of materials providing no base color factor.
+        static constexpr float DefaultIntensityFactor = 1.0f;
+
         MeshMap m_meshMap;
+        //! Bind pose meshes of skinned actors, keyed by the model asset ID of the actor.
+        ActorMeshMap m_actorMeshMap;
+        //! Bind pose meshes of actors split into rigid parts, keyed by the model asset ID of the actor.
+        ActorMeshMap m_rigidActorMeshMap;
+        //! Textures of materials without a base color image, keyed by the material asset ID.
         TextureMap m_textureMap;
+        //! Textures created from base color images, keyed by the image asset ID. Shared by all materials using the image.
+        TextureMap m_imageTextureMap;
+        //! Textures used in place of the image textures until they are created, keyed by the material asset ID.
+        //! Kept until the library is cleared, since they may still be referenced by RGL entities.
+        TextureMap m_placeholderTextureMap;
+        //! Placeholder textures whose image textures are still being created.
+        AZStd::unordered_set<const Wrappers::RglTexture*> m_pendingPlaceholderTextures;
+        //! Base color images of the materials with placeholder textures.
+        AZStd::unordered_map<AZ::Data::AssetId, AZ::Data::AssetId> m_materialImageIds;
+        //! Materials waiting for the texture of each image loaded in the background.
+        AZStd::unordered_map<AZ::Data::AssetId, AZStd::vector<AZ::Data::AssetId>> m_pendingImageMaterials;
+        //! Images which failed to be loaded or decoded. Materials using them are represented by their base color factor.
+        AZStd::unordered_set<AZ::Data::AssetId> m_failedImageIds;
+        TextureLoader m_textureLoader;
+        MaterialTextureConfiguration m_textureConfig;
+        AZStd::vector<TextureLoader::LoadedTexture> m_loadedTextures; //!< Cached to avoid reallocation on each update.
     };
 } // namespace RGL
\ No newline at end of file
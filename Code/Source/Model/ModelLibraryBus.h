@@ -20,33 +20,66 @@
 #include <AzCore/Component/EntityId.h>
 #include <AzCore/EBus/EBus.h>
 #include <AzCore/Interface/Interface.h>
+#include <AzCore/std/containers/vector.h>
+#include <Wrappers/RglMesh.h>
 
 namespace RGL
 {
     namespace Wrappers
     {
         class RglTexture;
-        class RglMesh;
     } // namespace Wrappers
 
     using MeshMaterialSlotPairList = AZStd::vector<AZStd::pair<Wrappers::RglMesh, AZ::RPI::ModelMaterialSlot>>;
 
+    //! RGL meshes created from the bind pose of an actor LOD, shared by all instances of the actor.
+    struct ActorMeshList
+    {
+        AZStd::vector<Wrappers::RglMesh> m_meshes;
+        //! Index of the EMotionFX sub mesh each mesh was created from.
+        AZStd::vector<size_t> m_subMeshIndices;
+        //! Index of the joint each mesh follows. Empty unless the meshes are rigid parts of the actor.
+        AZStd::vector<size_t> m_jointIndices;
+    };
+
     class ModelLibraryRequests
     {
     public:
         AZ_RTTI(ModelLibraryRequests, "{b84ccaae-5d0f-410a-821e-5ff8d449b851}");
 
-        //! Returns a vector of RGL meshes created from the modelAsset.
-        //! If the provided modelAsset was not encountered before, created RGL meshes are stored by the library.
-        //! On the other hand if the RGL meshes associated with the provided modelAsset were stored it will simply retrieve them.
+        //! Returns a vector of RGL meshes created from the provided LOD of the modelAsset.
+        //! If the provided modelAsset LOD was not encountered before, created RGL meshes are stored by the library.
+        //! On the other hand if the RGL meshes associated with the provided modelAsset LOD were stored it will simply retrieve them.
         //! @param modelAsset Model asset provided for storage.
-        //! @return List of RGL meshes created using the provided model asset.
-        virtual const MeshMaterialSlotPairList& StoreModelAsset(const AZ::Data::Asset<AZ::RPI::ModelAsset>& modelAsset) = 0;
+        //! @param lodIndex Index of the LOD (0 being the highest) to create meshes from. Clamped to the available LODs.
+        //! @return List of RGL meshes created using the provided model asset, matching the meshes of the LOD.
+        //! Meshes which failed to be created are invalid.
+        virtual const MeshMaterialSlotPairList& StoreModelAsset(
+            const AZ::Data::Asset<AZ::RPI::ModelAsset>& modelAsset, size_t lodIndex) = 0;
 
         //! Returns the texture created using provided materialAsset.
         //! The returned texture reference may point to an invalid texture.
+        //! If the material uses a base color image, a placeholder texture based on the base color factor is returned first,
+        //! while the image is loaded in the background. Once it is ready, OnMaterialTextureReady is sent to the placeholder address.
         virtual const Wrappers::RglTexture& StoreMaterialAsset(const AZ::Data::Asset<AZ::RPI::MaterialAsset>& materialAsset) = 0;
 
+        //! Returns true if the texture is a placeholder returned by StoreMaterialAsset, whose image texture is still being created.
+        //! Users of the placeholder should connect to the ModelLibraryNotificationBus at its address.
+        virtual bool IsPlaceholderTexture(const Wrappers::RglTexture& texture) const = 0;
+
+        //! Returns the RGL meshes of the provided actor LOD stored using StoreActorMeshes.
+        //! @param actorAssetId ID of the model asset of the actor.
+        //! @param lodIndex Index of the actor LOD the meshes were created from.
+        //! @param areJointsRigid Whether the meshes were split into rigid parts following single joints.
+        //! @return Stored meshes or nullptr if no meshes were stored for the provided actor LOD yet.
+        virtual const ActorMeshList* FindActorMeshes(const AZ::Data::AssetId& actorAssetId, size_t lodIndex, bool areJointsRigid) const = 0;
+
+        //! Stores RGL meshes created from the bind pose of the provided actor LOD, so that other instances of the actor can share them.
+        //! Shared meshes must not be deformed. Instances deforming their mesh have to create their own copies.
+        //! @return Stored meshes. They remain valid until the library is cleared.
+        virtual const ActorMeshList& StoreActorMeshes(
+            const AZ::Data::AssetId& actorAssetId, size_t lodIndex, bool areJointsRigid, ActorMeshList&& meshes) = 0;
+
     protected:
         ~ModelLibraryRequests() = default;
     };
@@ -63,4 +96,28 @@ namespace RGL
 
     using ModelLibraryRequestBus = AZ::EBus<ModelLibraryRequests, ModelLibraryBusTraits>;
     using ModelLibraryInterface = AZ::Interface<ModelLibraryRequests>;
+
+    //! Notifications addressed by the placeholder texture, so that only the users of the placeholder are notified.
+    class ModelLibraryNotifications : public AZ::EBusTraits
+    {
+    public:
+        //////////////////////////////////////////////////////////////////////////
+        // EBusTraits overrides
+        static constexpr AZ::EBusHandlerPolicy HandlerPolicy = AZ::EBusHandlerPolicy::Multiple;
+        static constexpr AZ::EBusAddressPolicy AddressPolicy = AZ::EBusAddressPolicy::ById;
+        using BusIdType = const Wrappers::RglTexture*;
+        //////////////////////////////////////////////////////////////////////////
+
+        //! Called when the texture of a material was created in the background.
+        //! All uses of the placeholder texture should be replaced with the provided texture.
+        //! The placeholder texture remains valid until the library is cleared.
+        //! @param placeholder Texture returned by StoreMaterialAsset while the material texture was being created.
+        //! @param texture Texture created from the base color image of the material.
+        virtual void OnMaterialTextureReady(const Wrappers::RglTexture& placeholder, const Wrappers::RglTexture& texture) = 0;
+
+    protected:
+        ~ModelLibraryNotifications() = default;
+    };
+
+    using ModelLibraryNotificationBus = AZ::EBus<ModelLibraryNotifications>;
 } // namespace RGL
\ No newline at end of file
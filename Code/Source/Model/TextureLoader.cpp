@@ -0,0 +1,128 @@
+/* Copyright 2024, Robotec.ai sp. z o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/std/parallel/thread.h>
+#include <Model/TextureLoader.h>
+#include <Utilities/TextureDecoding.h>
+
+namespace RGL
+{
+    TextureLoader::~TextureLoader()
+    {
+        Clear();
+    }
+
+    void TextureLoader::Load(const AZ::Data::AssetId& imageAssetId, const MaterialTextureConfiguration& config)
+    {
+        AZ::Data::Asset<AZ::RPI::StreamingImageAsset> imageAsset =
+            AZ::Data::AssetManager::Instance().GetAsset<AZ::RPI::StreamingImageAsset>(
+                imageAssetId,
+                AZ::Data::AssetLoadBehavior::PreLoad,
+                AZ::Data::AssetLoadParameters(nullptr, AZ::Data::AssetDependencyLoadRules::LoadAll));
+        imageAsset.QueueLoad();
+
+        m_pendingLoads.push_back({ AZStd::move(imageAsset), config, nullptr });
+    }
+
+    void TextureLoader::Update(AZStd::vector<LoadedTexture>& loadedTextures)
+    {
+        for (auto pendingIt = m_pendingLoads.begin(); pendingIt != m_pendingLoads.end();)
+        {
+            PendingLoad& pendingLoad = *pendingIt;
+            if (!pendingLoad.m_decodeResult)
+            {
+                if (pendingLoad.m_imageAsset.IsError())
+                {
+                    AZ_Warning(
+                        __func__,
+                        false,
+                        "Failed to load image asset with ID: %s.",
+                        pendingLoad.m_imageAsset.GetId().ToString<AZStd::string>().c_str());
+                    loadedTextures.emplace_back(pendingLoad.m_imageAsset.GetId(), Wrappers::RglTexture::CreateInvalid());
+                    pendingIt = m_pendingLoads.erase(pendingIt);
+                    continue;
+                }
+
+                if (pendingLoad.m_imageAsset.IsReady())
+                {
+                    StartDecoding(pendingLoad);
+                }
+
+                ++pendingIt;
+                continue;
+            }
+
+            const DecodeResult& decodeResult = *pendingLoad.m_decodeResult;
+            if (!decodeResult.m_isDone.load(AZStd::memory_order_acquire))
+            {
+                ++pendingIt;
+                continue;
+            }
+
+            if (decodeResult.m_isSuccessful)
+            {
+                const Wrappers::RglTexture::TexelData& texelData = decodeResult.m_texelData;
+                loadedTextures.emplace_back(
+                    pendingLoad.m_imageAsset.GetId(),
+                    Wrappers::RglTexture(texelData.m_texels.data(), texelData.m_width, texelData.m_height));
+            }
+            else
+            {
+                loadedTextures.emplace_back(pendingLoad.m_imageAsset.GetId(), Wrappers::RglTexture::CreateInvalid());
+            }
+
+            pendingIt = m_pendingLoads.erase(pendingIt);
+        }
+    }
+
+    void TextureLoader::Clear()
+    {
+        // Jobs own their results, but they still have to finish before the module containing their code is unloaded.
+        for (const PendingLoad& pendingLoad : m_pendingLoads)
+        {
+            while (pendingLoad.m_decodeResult && !pendingLoad.m_decodeResult->m_isDone.load(AZStd::memory_order_acquire))
+            {
+                AZStd::this_thread::yield();
+            }
+        }
+
+        m_pendingLoads.clear();
+    }
+
+    bool TextureLoader::IsEmpty() const
+    {
+        return m_pendingLoads.empty();
+    }
+
+    void TextureLoader::StartDecoding(PendingLoad& pendingLoad)
+    {
+        pendingLoad.m_decodeResult = AZStd::make_shared<DecodeResult>();
+
+        AZ::Job* job = AZ::CreateJobFunction(
+            [imageAsset = pendingLoad.m_imageAsset, config = pendingLoad.m_config, decodeResult = pendingLoad.m_decodeResult]()
+            {
+                Wrappers::RglTexture::TexelData& texelData = decodeResult->m_texelData;
+                decodeResult->m_isSuccessful = Wrappers::RglTexture::DecodeImageAsset(imageAsset, texelData, config.m_maxTexelCount);
+                if (decodeResult->m_isSuccessful)
+                {
+                    Utils::CollapseUniformLuminance(
+                        texelData.m_texels, texelData.m_width, texelData.m_height, config.m_uniformityTolerance);
+                }
+                decodeResult->m_isDone.store(true, AZStd::memory_order_release);
+            },
+            true);
+        job->Start();
+    }
+} // namespace RGL
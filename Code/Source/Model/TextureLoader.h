@@ -0,0 +1,76 @@
+/* Copyright 2024, Robotec.ai sp. z o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <Atom/RPI.Reflect/Image/StreamingImageAsset.h>
+#include <AzCore/Asset/AssetCommon.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
+#include <AzCore/std/utils.h>
+#include <RGL/SceneConfiguration.h>
+#include <Wrappers/RglTexture.h>
+
+namespace RGL
+{
+    //! Creates RGL textures from image assets without stalling the main thread.
+    //! Image assets are loaded asynchronously and decoded by jobs, each using its own texel buffer.
+    //! Only the upload of the decoded texels to RGL happens on the main thread.
+    class TextureLoader
+    {
+    public:
+        using LoadedTexture = AZStd::pair<AZ::Data::AssetId, Wrappers::RglTexture>;
+
+        TextureLoader() = default;
+        TextureLoader(TextureLoader&& other) = default;
+        TextureLoader(const TextureLoader& other) = delete;
+        ~TextureLoader();
+
+        //! Queues the load of the image asset without blocking.
+        //! @param imageAssetId ID of the image asset the texture is created from.
+        //! @param config Configuration applied to the created texture.
+        void Load(const AZ::Data::AssetId& imageAssetId, const MaterialTextureConfiguration& config);
+
+        //! Starts decoding of loaded images and uploads the decoded ones to RGL. Has to be called from the main thread.
+        //! @param loadedTextures Textures of the images processed since the last update, keyed by the image asset ID, are appended to it.
+        //! Textures of images which failed to be loaded or decoded (e.g. due to an unsupported format) are invalid.
+        void Update(AZStd::vector<LoadedTexture>& loadedTextures);
+
+        //! Drops all pending requests. Waits for the decoding jobs already started.
+        void Clear();
+
+        [[nodiscard]] bool IsEmpty() const;
+
+    private:
+        //! Shared with the decoding job, so that it stays valid even if the request is dropped.
+        struct DecodeResult
+        {
+            Wrappers::RglTexture::TexelData m_texelData;
+            bool m_isSuccessful{ false };
+            AZStd::atomic_bool m_isDone{ false };
+        };
+
+        struct PendingLoad
+        {
+            AZ::Data::Asset<AZ::RPI::StreamingImageAsset> m_imageAsset;
+            MaterialTextureConfiguration m_config;
+            AZStd::shared_ptr<DecodeResult> m_decodeResult; //!< Null until the decoding job is started.
+        };
+
+        void StartDecoding(PendingLoad& pendingLoad);
+
+        AZStd::vector<PendingLoad> m_pendingLoads;
+    };
+} // namespace RGL
@@ -18,6 +18,7 @@
 #include <AzCore/Module/Module.h>
 #include <Entity/Terrain/TerrainEntityManagerSystemComponent.h>
 #include <RGLSystemComponent.h>
+#include <RaycastGeometryComponent.h>
 #include <SceneConfigurationComponent.h>
 
 namespace RGL
@@ -40,6 +41,7 @@ namespace RGL
                     RGLSystemComponent::CreateDescriptor(),
                     TerrainEntityManagerSystemComponent::CreateDescriptor(),
                     SceneConfigurationComponent::CreateDescriptor(),
+                    RaycastGeometryComponent::CreateDescriptor(),
                 });
         }
 
@@ -14,18 +14,119 @@
  */
 
 #include <AtomLyIntegration/CommonFeatures/Mesh/MeshComponentConstants.h>
+#include <AzCore/Asset/AssetManagerBus.h>
 #include <AzCore/Component/TickBus.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/limits.h>
 #include <AzFramework/Entity/EntityContext.h>
 #include <AzFramework/Entity/GameEntityContextBus.h>
 #include <Entity/ActorEntityManager.h>
+#include <Entity/ColliderEntityManager.h>
 #include <Entity/EntityManager.h>
 #include <Entity/MeshEntityManager.h>
 #include <Integration/Components/ActorComponent.h>
 #include <RGLSystemComponent.h>
+#include <RaycastGeometryComponent.h>
 #include <Utilities/RGLUtils.h>
 
 namespace RGL
 {
+    namespace
+    {
+        constexpr size_t DefaultPrintedMemoryConsumerCount = 10U;
+
+        float ToMebibytes(size_t bytes)
+        {
+            return aznumeric_cast<float>(bytes) / (1024.0f * 1024.0f);
+        }
+
+        void PrintMemoryUsage(const char* name, const MemoryUsage& usage)
+        {
+            AZ_Printf(
+                "RGL",
+                "%10.3f MiB | vertices %.3f, indices %.3f, uvs %.3f, textures %.3f, ray poses %.3f, results %.3f | %s\n",
+                ToMebibytes(usage.GetTotalBytes()),
+                ToMebibytes(usage.m_vertexBytes),
+                ToMebibytes(usage.m_indexBytes),
+                ToMebibytes(usage.m_uvBytes),
+                ToMebibytes(usage.m_textureBytes),
+                ToMebibytes(usage.m_rayPoseBytes),
+                ToMebibytes(usage.m_resultBytes),
+                name);
+        }
+
+        //! Prints the consumers from the provided map that use the most memory.
+        template<typename KeyT, typename NameGetterT>
+        void PrintTopMemoryConsumers(
+            const char* title, const AZStd::unordered_map<KeyT, MemoryUsage>& consumers, size_t count, NameGetterT&& nameGetter)
+        {
+            AZStd::vector<AZStd::pair<KeyT, MemoryUsage>> sortedConsumers(consumers.begin(), consumers.end());
+            count = AZStd::min(count, sortedConsumers.size());
+            AZStd::sort(
+                sortedConsumers.begin(),
+                sortedConsumers.end(),
+                [](const auto& lhs, const auto& rhs)
+                {
+                    return lhs.second.GetTotalBytes() > rhs.second.GetTotalBytes();
+                });
+
+            AZ_Printf("RGL", "Top %zu of %zu %s:\n", count, sortedConsumers.size(), title);
+            for (size_t i = 0U; i < count; ++i)
+            {
+                PrintMemoryUsage(nameGetter(sortedConsumers[i].first).c_str(), sortedConsumers[i].second);
+            }
+        }
+
+        void rgl_PrintMemoryUsage(const AZ::ConsoleCommandContainer& arguments)
+        {
+            size_t count = DefaultPrintedMemoryConsumerCount;
+            if (!arguments.empty())
+            {
+                AZ::ConsoleTypeHelpers::ToValue(count, arguments);
+            }
+
+            MemoryUsageReport report;
+            MemoryUsageRequestBus::Broadcast(&MemoryUsageRequests::CollectMemoryUsage, report);
+
+            PrintMemoryUsage("Total", report.GetTotal());
+            PrintTopMemoryConsumers(
+                "assets",
+                report.m_assets,
+                count,
+                [](const AZ::Data::AssetId& assetId)
+                {
+                    AZStd::string assetPath;
+                    AZ::Data::AssetCatalogRequestBus::BroadcastResult(
+                        assetPath, &AZ::Data::AssetCatalogRequests::GetAssetPathById, assetId);
+                    return AZStd::string::format("%s %s", assetId.ToString<AZStd::string>().c_str(), assetPath.c_str());
+                });
+            PrintTopMemoryConsumers(
+                "entities",
+                report.m_entities,
+                count,
+                [](const AZ::EntityId& entityId)
+                {
+                    AZStd::string entityName;
+                    AZ::ComponentApplicationBus::BroadcastResult(entityName, &AZ::ComponentApplicationRequests::GetEntityName, entityId);
+                    return AZStd::string::format("%s %s", entityId.ToString().c_str(), entityName.c_str());
+                });
+            PrintTopMemoryConsumers(
+                "other consumers",
+                report.m_other,
+                count,
+                [](const AZStd::string& name)
+                {
+                    return name;
+                });
+        }
+    } // namespace
+
+    AZ_CONSOLEFREEFUNC(
+        rgl_PrintMemoryUsage,
+        AZ::ConsoleFunctorFlags::Null,
+        "Prints the memory used by the RGL scene along with its top N consumers. Usage: rgl_PrintMemoryUsage [N]");
+
     void RGLSystemComponent::Reflect(AZ::ReflectContext* context)
     {
         if (AZ::SerializeContext* serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
@@ -63,15 +164,29 @@ namespace RGL
 
     RGLSystemComponent::RGLSystemComponent()
     {
-        RGL_CHECK(rgl_configure_logging(RGL_LOG_LEVEL_WARN, nullptr, true));
         if (!RGLInterface::Get())
         {
             RGLInterface::Register(this);
+            m_rglExecutor = AZStd::make_unique<RglExecutor>();
+            RglExecutorInterface::Register(m_rglExecutor.get());
         }
+
+        Utils::ExecuteRglCommand(
+            []()
+            {
+                RGL_CHECK(rgl_configure_logging(RGL_LOG_LEVEL_WARN, nullptr, true));
+            });
     }
 
     RGLSystemComponent::~RGLSystemComponent()
     {
+        if (m_rglExecutor)
+        {
+            // RGL objects destroyed later on are destroyed in place, once the commands still in the queue are executed.
+            RglExecutorInterface::Unregister(m_rglExecutor.get());
+            m_rglExecutor.reset();
+        }
+
         if (RGLInterface::Get() == this)
         {
             RGLInterface::Unregister(this);
@@ -87,32 +202,51 @@ namespace RGL
 
         AzFramework::EntityContextEventBus::Handler::BusConnect(gameEntityContextId);
         LidarSystemNotificationBus::Handler::BusConnect();
+        MemoryUsageRequestBus::Handler::BusConnect();
+        AZ::TickBus::Handler::BusConnect();
 
+        m_modelLibrary.SetTextureConfiguration(m_sceneConfig.m_materialTextureConfig);
         m_rglLidarSystem.Activate();
     }
 
     void RGLSystemComponent::Deactivate()
     {
         m_rglLidarSystem.Deactivate();
+        AZ::TickBus::Handler::BusDisconnect();
+        MemoryUsageRequestBus::Handler::BusDisconnect();
         LidarSystemNotificationBus::Handler::BusDisconnect();
         AzFramework::EntityContextEventBus::Handler::BusDisconnect();
 
-        m_entityManagers.clear();
+        ClearEntityManagers();
         m_modelLibrary.Clear();
         m_rglLidarSystem.Clear();
     }
 
     void RGLSystemComponent::ExcludeEntity(const AZ::EntityId& excludedEntityId)
     {
-        if (!m_entityManagers.erase(excludedEntityId))
+        m_unmanagedColliderEntities.erase(excludedEntityId);
+        if (!m_entityManagers.contains(excludedEntityId))
         {
             m_excludedEntities.insert(excludedEntityId);
+            return;
         }
+
+        RemoveEntityManager(excludedEntityId);
     }
 
     void RGLSystemComponent::SetSceneConfiguration(const SceneConfiguration& config)
     {
+        const bool isGeometrySourceChanged = m_sceneConfig.m_isColliderGeometryEnabled != config.m_isColliderGeometryEnabled;
+        const MaterialTextureConfiguration& textureConfig = m_sceneConfig.m_materialTextureConfig;
+        const bool isTextureConfigChanged = textureConfig.m_maxTexelCount != config.m_materialTextureConfig.m_maxTexelCount ||
+            textureConfig.m_uniformityTolerance != config.m_materialTextureConfig.m_uniformityTolerance;
         m_sceneConfig = config;
+        m_modelLibrary.SetTextureConfiguration(config.m_materialTextureConfig);
+        if (isGeometrySourceChanged || isTextureConfigChanged)
+        {
+            ReprocessEntities(isTextureConfigChanged);
+        }
+
         RGLNotificationBus::Broadcast(&RGLNotifications::OnSceneConfigurationSet, config);
     }
 
@@ -140,13 +274,15 @@ namespace RGL
     void RGLSystemComponent::OnEntityContextDestroyEntity(const AZ::EntityId& id)
     {
         m_unprocessedEntities.erase(id);
-        m_entityManagers.erase(id);
+        m_unmanagedColliderEntities.erase(id);
+        RemoveEntityManager(id);
     }
 
     void RGLSystemComponent::OnEntityContextReset()
     {
-        m_entityManagers.clear();
+        ClearEntityManagers();
         m_unprocessedEntities.clear();
+        m_unmanagedColliderEntities.clear();
         m_modelLibrary.Clear();
         m_rglLidarSystem.Clear();
     }
@@ -185,16 +321,73 @@ namespace RGL
         {
             m_unprocessedEntities.emplace(m_entityManager.first);
         }
-        m_entityManagers.clear();
+        m_unprocessedEntities.insert(m_unmanagedColliderEntities.begin(), m_unmanagedColliderEntities.end());
+        m_unmanagedColliderEntities.clear();
+        ClearEntityManagers();
         m_modelLibrary.Clear();
     }
 
+    void RGLSystemComponent::CollectMemoryUsage(MemoryUsageReport& report) const
+    {
+        m_modelLibrary.CollectMemoryUsage(report);
+        m_rglLidarSystem.CollectMemoryUsage(report);
+        for (const auto& [entityId, entityManager] : m_entityManagers)
+        {
+            entityManager->CollectMemoryUsage(report);
+        }
+        m_staticBatcher.CollectMemoryUsage(report);
+    }
+
+    void RGLSystemComponent::OnTick(float deltaTime, AZ::ScriptTimePoint time)
+    {
+        // The scene is only updated in ticks in which a lidar is expected to raycast, as it would be by the raycast itself.
+        // Unpredicted raycasts update the scene in place.
+        if (m_activeLidarCount < 1U || !m_rglLidarSystem.IsRaycastDue(time.GetSeconds(), deltaTime))
+        {
+            return;
+        }
+
+        // Most RGL calls of the update (e.g. entity transforms and vertices) are posted to the RGL executor,
+        // so the upload overlaps with the rest of the tick until the lidars raycast. Since the commands are executed
+        // in the submission order, the raycasts are executed once the upload is done.
+        UpdateScene();
+    }
+
+    int RGLSystemComponent::GetTickOrder()
+    {
+        // After the entities are moved and animated, but before the lidars (ticking with the default order) raycast.
+        return AZ::TICK_PRE_RENDER;
+    }
+
     void RGLSystemComponent::ProcessEntity(const AZ::Entity& entity)
     {
+        const bool hasColliders = Utils::HasProvidedService(entity, AZ_CRC_CE("PhysicsColliderService"));
+        bool useColliderGeometry = m_sceneConfig.m_isColliderGeometryEnabled;
+        const auto* raycastGeometryComponent = entity.FindComponent<RaycastGeometryComponent>();
+        if (raycastGeometryComponent)
+        {
+            const RaycastGeometrySource geometrySource = raycastGeometryComponent->GetGeometrySource();
+            if (geometrySource != RaycastGeometrySource::SceneDefault)
+            {
+                useColliderGeometry = geometrySource == RaycastGeometrySource::Colliders;
+            }
+        }
+
         AZStd::unique_ptr<EntityManager> entityManager;
         if (entity.FindComponent<EMotionFX::Integration::ActorComponent>())
         {
-            entityManager = AZStd::make_unique<ActorEntityManager>(entity.GetId());
+            // Skinned meshes are not represented by colliders, since these do not follow the deformation.
+            const bool areJointsRigid = raycastGeometryComponent && raycastGeometryComponent->AreActorJointsRigid();
+            auto actorEntityManager = AZStd::make_unique<ActorEntityManager>(entity.GetId(), areJointsRigid);
+            if (raycastGeometryComponent)
+            {
+                actorEntityManager->SetAnimationLodOverride(raycastGeometryComponent->GetAnimationLodOverride());
+            }
+            entityManager = AZStd::move(actorEntityManager);
+        }
+        else if (hasColliders && useColliderGeometry)
+        {
+            entityManager = AZStd::make_unique<ColliderEntityManager>(entity.GetId());
         }
         else if (entity.FindComponent(AZ::Render::MeshComponentTypeId))
         {
@@ -202,13 +395,142 @@ namespace RGL
         }
         else
         {
+            if (hasColliders)
+            {
+                m_unmanagedColliderEntities.insert(entity.GetId());
+            }
             return;
         }
 
+        // With geometry streaming enabled, the entity is added to the RGL scene once a lidar gets close enough.
+        entityManager->SetIsResident(!m_sceneConfig.m_geometryStreamingConfig.m_isEnabled);
+
         [[maybe_unused]] bool inserted = m_entityManagers.emplace(entity.GetId(), AZStd::move(entityManager)).second;
         AZ_Error(__func__, inserted, "Object with provided entityId already exists.");
     }
 
+    void RGLSystemComponent::ReprocessEntities(bool areTexturesRecreated)
+    {
+        if (m_activeLidarCount < 1U)
+        {
+            // Entities are processed with the current configuration once any lidar is created.
+            if (areTexturesRecreated && m_entityManagers.empty())
+            {
+                m_modelLibrary.ClearTextures();
+            }
+            return;
+        }
+
+        AZStd::vector<AZ::EntityId> entityIds(m_unmanagedColliderEntities.begin(), m_unmanagedColliderEntities.end());
+        entityIds.reserve(entityIds.size() + m_entityManagers.size());
+        for (const auto& [entityId, entityManager] : m_entityManagers)
+        {
+            entityIds.push_back(entityId);
+        }
+
+        ClearEntityManagers();
+        m_unmanagedColliderEntities.clear();
+        if (areTexturesRecreated)
+        {
+            // Textures can only be cleared once no manager refers to them.
+            m_modelLibrary.ClearTextures();
+        }
+
+        for (const AZ::EntityId& entityId : entityIds)
+        {
+            AZ::Entity* entity = nullptr;
+            AZ::ComponentApplicationBus::BroadcastResult(entity, &AZ::ComponentApplicationRequests::FindEntity, entityId);
+            if (entity)
+            {
+                ProcessEntity(*entity);
+            }
+        }
+    }
+
+    void RGLSystemComponent::UpdateLidarObservations()
+    {
+        const GeometryStreamingConfiguration& streamingConfig = m_sceneConfig.m_geometryStreamingConfig;
+        if (!streamingConfig.m_isEnabled && !m_sceneConfig.m_lodSelectionConfig.m_isEnabled &&
+            !m_sceneConfig.m_animationLodConfig.m_isEnabled)
+        {
+            for (auto&& [entityId, entityManager] : m_entityManagers)
+            {
+                entityManager->SetIsResident(true);
+            }
+            return;
+        }
+
+        for (auto&& [entityId, entityManager] : m_entityManagers)
+        {
+            if (entityManager->IsWorldBoundsUpdateNeeded())
+            {
+                m_entitySpatialIndex.Update(entityId, entityManager->UpdateWorldBounds());
+            }
+        }
+
+        m_lidarObservations.clear();
+        const float streamingQueryMargin = streamingConfig.m_isEnabled ? streamingConfig.m_margin + streamingConfig.m_hysteresis : 0.0f;
+        for (const LidarVolume& lidarVolume : m_lidarVolumes)
+        {
+            m_spatialQueryResults.clear();
+            m_entitySpatialIndex.Query(lidarVolume.m_position, lidarVolume.m_maxRange + streamingQueryMargin, m_spatialQueryResults);
+            for (const auto& [entityId, distance] : m_spatialQueryResults)
+            {
+                const LidarObservation observation{ distance - lidarVolume.m_maxRange, distance, lidarVolume.m_angularResolution };
+                auto [it, inserted] = m_lidarObservations.emplace(entityId, observation);
+                if (inserted)
+                {
+                    continue;
+                }
+
+                LidarObservation& combined = it->second;
+                combined.m_rangeExcess = AZStd::min(combined.m_rangeExcess, observation.m_rangeExcess);
+                // The smaller the product, the more rays are expected to hit the entity.
+                if (observation.m_distance * observation.m_angularResolution < combined.m_distance * combined.m_angularResolution)
+                {
+                    combined.m_distance = observation.m_distance;
+                    combined.m_angularResolution = observation.m_angularResolution;
+                }
+            }
+        }
+
+        static constexpr float Infinity = AZStd::numeric_limits<float>::infinity();
+        static constexpr LidarObservation NoObservation{ Infinity, Infinity, 0.0f };
+        for (auto&& [entityId, entityManager] : m_entityManagers)
+        {
+            const auto observationIt = m_lidarObservations.find(entityId);
+            const LidarObservation& observation = observationIt != m_lidarObservations.end() ? observationIt->second : NoObservation;
+            entityManager->SetLidarObservation(observation.m_distance, observation.m_angularResolution, observation.m_rangeExcess);
+
+            if (!streamingConfig.m_isEnabled)
+            {
+                entityManager->SetIsResident(true);
+            }
+            else if (!entityManager->IsResident() && observation.m_rangeExcess <= streamingConfig.m_margin)
+            {
+                entityManager->SetIsResident(true);
+            }
+            else if (entityManager->IsResident() && observation.m_rangeExcess > streamingConfig.m_margin + streamingConfig.m_hysteresis)
+            {
+                entityManager->SetIsResident(false);
+            }
+        }
+    }
+
+    void RGLSystemComponent::RemoveEntityManager(AZ::EntityId entityId)
+    {
+        m_entitySpatialIndex.Remove(entityId);
+        m_staticBatcher.Remove(entityId);
+        m_entityManagers.erase(entityId);
+    }
+
+    void RGLSystemComponent::ClearEntityManagers()
+    {
+        m_entitySpatialIndex.Clear();
+        m_staticBatcher.Clear();
+        m_entityManagers.clear();
+    }
+
     void RGLSystemComponent::UpdateScene()
     {
         AZ::ScriptTimePoint currentTime;
@@ -218,11 +540,80 @@ namespace RGL
         {
             return;
         }
+        const float deltaTime = m_sceneUpdateLastTime.GetSeconds() > 0.0
+            ? aznumeric_cast<float>(currentTime.GetSeconds() - m_sceneUpdateLastTime.GetSeconds())
+            : 0.0f;
         m_sceneUpdateLastTime = currentTime;
 
+        m_modelLibrary.Update();
+
+        m_lidarVolumes.clear();
+        m_rglLidarSystem.CollectLidarVolumes(m_lidarVolumes);
+        LidarSystemNotificationBus::Broadcast(&LidarSystemNotifications::OnLidarVolumesUpdated, m_lidarVolumes);
+        UpdateLidarObservations();
+
+        // The CPU work of the managers (e.g. skinning) runs in parallel, while RGL calls are made serially in Update.
+        m_parallelUpdateManagers.clear();
+        for (auto&& [entityId, entityManager] : m_entityManagers)
+        {
+            if (entityManager->PrepareParallelUpdate())
+            {
+                m_parallelUpdateManagers.push_back(entityManager.get());
+            }
+        }
+
+        // Managers modifying the same shared data (e.g. instances of an actor with morph targets, deformed in the actor's meshes)
+        // are updated serially, within a single job.
+        AZStd::sort(
+            m_parallelUpdateManagers.begin(),
+            m_parallelUpdateManagers.end(),
+            [](const EntityManager* lhs, const EntityManager* rhs)
+            {
+                return AZStd::less<const void*>{}(lhs->GetParallelUpdateGroup(), rhs->GetParallelUpdateGroup());
+            });
+
+        m_parallelUpdateGroups.clear();
+        for (size_t managerIdx = 0U; managerIdx < m_parallelUpdateManagers.size(); ++managerIdx)
+        {
+            const void* group = m_parallelUpdateManagers[managerIdx]->GetParallelUpdateGroup();
+            if (group && !m_parallelUpdateGroups.empty() &&
+                m_parallelUpdateManagers[m_parallelUpdateGroups.back().first]->GetParallelUpdateGroup() == group)
+            {
+                m_parallelUpdateGroups.back().second = managerIdx + 1U;
+                continue;
+            }
+
+            m_parallelUpdateGroups.emplace_back(managerIdx, managerIdx + 1U);
+        }
+
+        // The managers are split into chunks by their count, not by the group count, so that the jobs get similar amounts of work.
+        // Each job updates the whole groups starting within its chunk. A group larger than a chunk is still updated by one job.
+        Utils::ParallelFor(
+            m_parallelUpdateManagers.size(),
+            1U,
+            [this](size_t begin, size_t end)
+            {
+                auto groupIt = AZStd::lower_bound(
+                    m_parallelUpdateGroups.begin(),
+                    m_parallelUpdateGroups.end(),
+                    begin,
+                    [](const AZStd::pair<size_t, size_t>& group, size_t managerIdx)
+                    {
+                        return group.first < managerIdx;
+                    });
+                for (; groupIt != m_parallelUpdateGroups.end() && groupIt->first < end; ++groupIt)
+                {
+                    for (size_t managerIdx = groupIt->first; managerIdx < groupIt->second; ++managerIdx)
+                    {
+                        m_parallelUpdateManagers[managerIdx]->UpdateInParallel();
+                    }
+                }
+            });
+
         for (auto&& [entityId, entityManager] : m_entityManagers)
         {
             entityManager->Update();
         }
+        m_staticBatcher.Update(m_sceneConfig.m_staticBatchingConfig, m_entityManagers, deltaTime);
     }
 } // namespace RGL
@@ -15,13 +15,18 @@
 #pragma once
 
 #include <AzCore/Component/Component.h>
+#include <AzCore/Component/TickBus.h>
 #include <AzCore/Math/Vector3.h>
 #include <AzCore/Script/ScriptTimePoint.h>
 #include <AzFramework/Entity/EntityContextBus.h>
+#include <Entity/EntitySpatialIndex.h>
+#include <Entity/StaticBatcher.h>
 #include <Lidar/LidarSystem.h>
 #include <Lidar/LidarSystemNotificationBus.h>
 #include <Model/ModelLibrary.h>
+#include <RGL/MemoryUsageBus.h>
 #include <RGL/RGLBus.h>
+#include <Utilities/RglExecutor.h>
 
 namespace RGL
 {
@@ -32,6 +37,8 @@ namespace RGL
         , protected RGLRequestBus::Handler
         , protected AzFramework::EntityContextEventBus::Handler
         , protected LidarSystemNotificationBus::Handler
+        , protected MemoryUsageRequestBus::Handler
+        , protected AZ::TickBus::Handler
     {
     public:
         AZ_COMPONENT(RGL::RGLSystemComponent, "{dbd5b1c5-249f-4eca-a142-2533ebe7f680}");
@@ -66,18 +73,54 @@ namespace RGL
         void OnLidarCreated() override;
         void OnLidarDestroyed() override;
 
+        // MemoryUsageRequestBus overrides
+        void CollectMemoryUsage(MemoryUsageReport& report) const override;
+
+        // AZ::TickBus overrides
+        void OnTick(float deltaTime, AZ::ScriptTimePoint time) override;
+        int GetTickOrder() override;
+
     private:
         void ProcessEntity(const AZ::Entity& entity);
+        //! Recreates the managers of all processed entities, e.g. after a change of the raycast geometry source.
+        //! @param areTexturesRecreated If true, the material textures are recreated as well.
+        void ReprocessEntities(bool areTexturesRecreated = false);
+        //! Provides entity managers with the distance to lidars observing them (using m_lidarVolumes collected in UpdateScene).
+        //! If geometry streaming is enabled, adds entities located within the range of any lidar to the RGL scene
+        //! and removes the ones located far outside of it.
+        void UpdateLidarObservations();
+        void RemoveEntityManager(AZ::EntityId entityId);
+        void ClearEntityManagers();
 
+        //! Only created by the registered instance of the component. Destroyed after all RGL commands it was given are executed.
+        AZStd::unique_ptr<RglExecutor> m_rglExecutor;
         LidarSystem m_rglLidarSystem;
 
         ModelLibrary m_modelLibrary;
         AZStd::set<AZ::EntityId> m_excludedEntities;
         AZStd::set<AZ::EntityId> m_unprocessedEntities;
+        //! Processed entities with colliders for which no manager was created (collider geometry was disabled for them).
+        AZStd::set<AZ::EntityId> m_unmanagedColliderEntities;
         SceneConfiguration m_sceneConfig;
         AZStd::unordered_map<AZ::EntityId, AZStd::unique_ptr<EntityManager>> m_entityManagers;
+        StaticBatcher m_staticBatcher;
         AZ::ScriptTimePoint m_sceneUpdateLastTime{};
 
+        EntitySpatialIndex m_entitySpatialIndex;
+        AZStd::vector<LidarVolume> m_lidarVolumes; //!< Cached to avoid reallocation on each scene update.
+        AZStd::vector<EntitySpatialIndex::QueryResult> m_spatialQueryResults; //!< Cached to avoid reallocation on each scene update.
+        //! Observation of an entity by the lidars, combined over all lidars in range.
+        struct LidarObservation
+        {
+            float m_rangeExcess; //!< Smallest distance by which the entity exceeds the range of a lidar.
+            float m_distance; //!< Distance to the lidar with the highest density of rays at the entity.
+            float m_angularResolution; //!< Angular resolution of the lidar with the highest density of rays at the entity.
+        };
+        AZStd::unordered_map<AZ::EntityId, LidarObservation> m_lidarObservations; //!< Cached to avoid reallocation on each scene update.
+        AZStd::vector<EntityManager*> m_parallelUpdateManagers; //!< Cached to avoid reallocation on each scene update.
+        //! Ranges [begin, end) of m_parallelUpdateManagers sharing an update group. Cached to avoid reallocation on each scene update.
+        AZStd::vector<AZStd::pair<size_t, size_t>> m_parallelUpdateGroups;
+
         size_t m_activeLidarCount{};
     };
 } // namespace RGL
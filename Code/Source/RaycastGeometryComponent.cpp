@@ -0,0 +1,118 @@
+/* Copyright 2024, Robotec.ai sp. z o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <AzCore/Serialization/EditContext.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <RaycastGeometryComponent.h>
+
+namespace RGL
+{
+    void RaycastGeometryComponent::Reflect(AZ::ReflectContext* context)
+    {
+        if (auto* serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
+        {
+            serializeContext->Class<RaycastGeometryComponent, AZ::Component>()
+                ->Version(0)
+                ->Field("GeometrySource", &RaycastGeometryComponent::m_geometrySource)
+                ->Field("OverrideAnimationLod", &RaycastGeometryComponent::m_isAnimationLodOverridden)
+                ->Field("AnimationUpdateRateDivisor", &RaycastGeometryComponent::m_animationUpdateRateDivisor)
+                ->Field("AnimationFreezeDistance", &RaycastGeometryComponent::m_animationFreezeDistance)
+                ->Field("RigidActorJoints", &RaycastGeometryComponent::m_areActorJointsRigid);
+
+            if (auto* editContext = serializeContext->GetEditContext())
+            {
+                // clang-format off
+                editContext->Class<RaycastGeometryComponent>(
+                    "RGL Raycast Geometry", "Overrides the way the entity is represented in the RGL scene.")
+                    ->ClassElement(AZ::Edit::ClassElements::EditorData, "")
+                        ->Attribute(AZ::Edit::Attributes::Category, "RGL")
+                        ->Attribute(AZ::Edit::Attributes::AppearsInAddComponentMenu, AZ_CRC_CE("Game"))
+                    ->DataElement(
+                        AZ::Edit::UIHandlers::ComboBox,
+                        &RaycastGeometryComponent::m_geometrySource,
+                        "Geometry Source",
+                        "Source of the geometry used to represent the entity in the RGL scene.")
+                        ->EnumAttribute(RaycastGeometrySource::SceneDefault, "Scene default")
+                        ->EnumAttribute(RaycastGeometrySource::RenderMesh, "Render mesh")
+                        ->EnumAttribute(RaycastGeometrySource::Colliders, "Colliders")
+                    ->DataElement(
+                        AZ::Edit::UIHandlers::Default,
+                        &RaycastGeometryComponent::m_isAnimationLodOverridden,
+                        "Override Animation LOD",
+                        "If enabled, the animation LOD parameters of the scene configuration are overridden for this entity. "
+                        "Applies to skinned meshes only.")
+                        ->Attribute(AZ::Edit::Attributes::ChangeNotify, AZ::Edit::PropertyRefreshLevels::EntireTree)
+                    ->DataElement(
+                        AZ::Edit::UIHandlers::Default,
+                        &RaycastGeometryComponent::m_animationUpdateRateDivisor,
+                        "Animation Update Rate Divisor",
+                        "The skinned mesh of the entity is updated once every this many scene updates.")
+                        ->Attribute(AZ::Edit::Attributes::Min, 1U)
+                        ->Attribute(AZ::Edit::Attributes::Visibility, &RaycastGeometryComponent::IsAnimationLodOverridden)
+                    ->DataElement(
+                        AZ::Edit::UIHandlers::Default,
+                        &RaycastGeometryComponent::m_animationFreezeDistance,
+                        "Animation Freeze Distance",
+                        "Distance (in meters) to the nearest lidar beyond which the pose of the skinned mesh is frozen.")
+                        ->Attribute(AZ::Edit::Attributes::Min, 0.0f)
+                        ->Attribute(AZ::Edit::Attributes::Visibility, &RaycastGeometryComponent::IsAnimationLodOverridden)
+                    ->DataElement(
+                        AZ::Edit::UIHandlers::Default,
+                        &RaycastGeometryComponent::m_areActorJointsRigid,
+                        "Rigid Actor Joints",
+                        "If enabled, the skinned mesh of the entity is split into rigid parts, each following the joint with the "
+                        "highest skin weight. Only the transforms of the parts are updated instead of all vertices. "
+                        "Suitable for robots and machines with rigid links.");
+                // clang-format on
+            }
+        }
+    }
+
+    RaycastGeometrySource RaycastGeometryComponent::GetGeometrySource() const
+    {
+        return m_geometrySource;
+    }
+
+    AZStd::optional<AnimationLodConfiguration> RaycastGeometryComponent::GetAnimationLodOverride() const
+    {
+        if (!m_isAnimationLodOverridden)
+        {
+            return AZStd::nullopt;
+        }
+
+        AnimationLodConfiguration config;
+        config.m_isEnabled = true;
+        config.m_updateRateDivisor = m_animationUpdateRateDivisor;
+        config.m_freezeDistance = m_animationFreezeDistance;
+        return config;
+    }
+
+    bool RaycastGeometryComponent::AreActorJointsRigid() const
+    {
+        return m_areActorJointsRigid;
+    }
+
+    bool RaycastGeometryComponent::IsAnimationLodOverridden() const
+    {
+        return m_isAnimationLodOverridden;
+    }
+
+    void RaycastGeometryComponent::Activate()
+    {
+    }
+
+    void RaycastGeometryComponent::Deactivate()
+    {
+    }
+} // namespace RGL
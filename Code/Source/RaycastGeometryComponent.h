@@ -0,0 +1,69 @@
+/* Copyright 2024, Robotec.ai sp. z o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <AzCore/Component/Component.h>
+#include <AzCore/RTTI/TypeInfo.h>
+#include <AzCore/std/optional.h>
+#include <RGL/SceneConfiguration.h>
+
+namespace RGL
+{
+    //! Source of the geometry used to represent an entity in the RGL scene.
+    enum class RaycastGeometrySource : AZ::u8
+    {
+        SceneDefault, //!< Use the source defined in the scene configuration.
+        RenderMesh, //!< Use the render mesh of the entity.
+        Colliders, //!< Use the physics colliders of the entity.
+    };
+
+    //! Component allowing for per-entity overrides of the way the entity is represented in the RGL scene.
+    //! The configuration is read once, when the entity gets processed by the RGL system.
+    class RaycastGeometryComponent : public AZ::Component
+    {
+    public:
+        AZ_COMPONENT(RaycastGeometryComponent, "{5e8f6c2d-9a41-4b7e-8d3c-0f1a2b6e4c97}", AZ::Component);
+
+        RaycastGeometryComponent() = default;
+        ~RaycastGeometryComponent() override = default;
+
+        static void Reflect(AZ::ReflectContext* context);
+
+        [[nodiscard]] RaycastGeometrySource GetGeometrySource() const;
+        //! Returns the animation LOD parameters of the entity or nullopt if the scene configuration applies.
+        //! Whether the animation LOD is used at all is decided by the scene configuration.
+        [[nodiscard]] AZStd::optional<AnimationLodConfiguration> GetAnimationLodOverride() const;
+        //! Returns true if the skinned mesh of the entity should be split into rigid parts following single joints.
+        [[nodiscard]] bool AreActorJointsRigid() const;
+
+        // AZ::Component overrides
+        void Activate() override;
+        void Deactivate() override;
+
+    private:
+        [[nodiscard]] bool IsAnimationLodOverridden() const;
+
+        RaycastGeometrySource m_geometrySource{ RaycastGeometrySource::SceneDefault };
+        bool m_isAnimationLodOverridden{ false };
+        AZ::u32 m_animationUpdateRateDivisor{ 1U };
+        float m_animationFreezeDistance{ 50.0f };
+        bool m_areActorJointsRigid{ false };
+    };
+} // namespace RGL
+
+namespace AZ
+{
+    AZ_TYPE_INFO_SPECIALIZE(RGL::RaycastGeometrySource, "{c3b7e1a4-62d8-4f95-b0e2-7a9d5c8f1e36}");
+} // namespace AZ
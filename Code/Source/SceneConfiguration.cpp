@@ -19,6 +19,32 @@
 
 namespace RGL
 {
+    void SurfaceTagIntensity::Reflect(AZ::ReflectContext* context)
+    {
+        if (auto* serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
+        {
+            serializeContext->Class<SurfaceTagIntensity>()
+                ->Version(0)
+                ->Field("SurfaceTag", &SurfaceTagIntensity::m_surfaceTag)
+                ->Field("Intensity", &SurfaceTagIntensity::m_intensity);
+
+            if (auto* editContext = serializeContext->GetEditContext())
+            {
+                editContext->Class<SurfaceTagIntensity>("RGL Surface Tag Intensity", "")
+                    ->DataElement(
+                        AZ::Edit::UIHandlers::Default,
+                        &SurfaceTagIntensity::m_surfaceTag,
+                        "Surface Tag",
+                        "Name of the terrain surface tag (e.g. asphalt or grass).")
+                    ->DataElement(
+                        AZ::Edit::UIHandlers::Default,
+                        &SurfaceTagIntensity::m_intensity,
+                        "Intensity",
+                        "Intensity of the terrain surfaces with this tag. Must be in range [0, 255].");
+            }
+        }
+    }
+
     void TerrainIntensityConfiguration::Reflect(AZ::ReflectContext* context)
     {
         if (auto* serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
@@ -27,7 +53,9 @@ namespace RGL
                 ->Version(0)
                 ->Field("DefaultIntensity", &TerrainIntensityConfiguration::m_defaultValue)
                 ->Field("ColorTexture", &TerrainIntensityConfiguration::m_colorImageAsset)
-                ->Field("Tiled", &TerrainIntensityConfiguration::m_isTiled);
+                ->Field("Tiled", &TerrainIntensityConfiguration::m_isTiled)
+                ->Field("SurfaceTagIntensityEnabled", &TerrainIntensityConfiguration::m_isSurfaceTagIntensityEnabled)
+                ->Field("SurfaceTagIntensities", &TerrainIntensityConfiguration::m_surfaceTagIntensities);
 
             if (auto* editContext = serializeContext->GetEditContext())
             {
@@ -47,20 +75,258 @@ namespace RGL
                         AZ::Edit::UIHandlers::Default,
                         &TerrainIntensityConfiguration::m_isTiled,
                         "Tiled",
-                        "If enabled, the provided color texture is tiled over the terrain grid. Enabled by default");
+                        "If enabled, the provided color texture is tiled over the terrain grid. Enabled by default")
+                    ->DataElement(
+                        AZ::Edit::UIHandlers::Default,
+                        &TerrainIntensityConfiguration::m_isSurfaceTagIntensityEnabled,
+                        "Surface Tag Intensity",
+                        "If enabled, the intensity is based on the terrain surface tags instead of the color texture. "
+                        "Each vertex uses the intensity of its surface tag with the highest weight, or the default intensity "
+                        "if none of its tags is listed. Disabled by default.")
+                    ->DataElement(
+                        AZ::Edit::UIHandlers::Default,
+                        &TerrainIntensityConfiguration::m_surfaceTagIntensities,
+                        "Surface Tag Intensities",
+                        "Intensities of the terrain surface tags.");
+            }
+        }
+    }
+
+    void TerrainMeshConfiguration::Reflect(AZ::ReflectContext* context)
+    {
+        if (auto* serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
+        {
+            serializeContext->Class<TerrainMeshConfiguration>()
+                ->Version(0)
+                ->Field("Adaptive", &TerrainMeshConfiguration::m_isAdaptive)
+                ->Field("MaxVerticalError", &TerrainMeshConfiguration::m_maxVerticalError);
+
+            if (auto* editContext = serializeContext->GetEditContext())
+            {
+                editContext->Class<TerrainMeshConfiguration>("RGL Terrain Mesh Configuration", "")
+                    ->DataElement(
+                        AZ::Edit::UIHandlers::Default,
+                        &TerrainMeshConfiguration::m_isAdaptive,
+                        "Adaptive Triangulation",
+                        "If enabled, flat parts of the terrain are represented by fewer, larger triangles. "
+                        "Disabled by default.")
+                    ->DataElement(
+                        AZ::Edit::UIHandlers::Default,
+                        &TerrainMeshConfiguration::m_maxVerticalError,
+                        "Max Vertical Error",
+                        "Maximal vertical distance (in meters) between the simplified mesh and the terrain heightfield.")
+                    ->Attribute(AZ::Edit::Attributes::Min, 0.0f);
+            }
+        }
+    }
+
+    void GeometryStreamingConfiguration::Reflect(AZ::ReflectContext* context)
+    {
+        if (auto* serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
+        {
+            serializeContext->Class<GeometryStreamingConfiguration>()
+                ->Version(0)
+                ->Field("Enabled", &GeometryStreamingConfiguration::m_isEnabled)
+                ->Field("Margin", &GeometryStreamingConfiguration::m_margin)
+                ->Field("Hysteresis", &GeometryStreamingConfiguration::m_hysteresis);
+
+            if (auto* editContext = serializeContext->GetEditContext())
+            {
+                editContext->Class<GeometryStreamingConfiguration>("RGL Geometry Streaming Configuration", "")
+                    ->DataElement(
+                        AZ::Edit::UIHandlers::Default,
+                        &GeometryStreamingConfiguration::m_isEnabled,
+                        "Enabled",
+                        "If enabled, only entities located within the range of any lidar are present in the RGL scene. "
+                        "Disabled by default.")
+                    ->DataElement(
+                        AZ::Edit::UIHandlers::Default,
+                        &GeometryStreamingConfiguration::m_margin,
+                        "Margin",
+                        "Distance (in meters) beyond the lidar range within which entities are added to the scene.")
+                    ->Attribute(AZ::Edit::Attributes::Min, 0.0f)
+                    ->DataElement(
+                        AZ::Edit::UIHandlers::Default,
+                        &GeometryStreamingConfiguration::m_hysteresis,
+                        "Hysteresis",
+                        "Additional distance (in meters) by which an entity has to exceed the margin before it is removed from the scene.")
+                    ->Attribute(AZ::Edit::Attributes::Min, 0.0f);
+            }
+        }
+    }
+
+    void LodSelectionConfiguration::Reflect(AZ::ReflectContext* context)
+    {
+        if (auto* serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
+        {
+            serializeContext->Class<LodSelectionConfiguration>()
+                ->Version(0)
+                ->Field("Enabled", &LodSelectionConfiguration::m_isEnabled)
+                ->Field("TrianglesPerHit", &LodSelectionConfiguration::m_trianglesPerHit)
+                ->Field("Hysteresis", &LodSelectionConfiguration::m_hysteresis);
+
+            if (auto* editContext = serializeContext->GetEditContext())
+            {
+                editContext->Class<LodSelectionConfiguration>("RGL LOD Selection Configuration", "")
+                    ->DataElement(
+                        AZ::Edit::UIHandlers::Default,
+                        &LodSelectionConfiguration::m_isEnabled,
+                        "Enabled",
+                        "If enabled, the LOD of each mesh is selected based on the distance to the nearest lidar "
+                        "and its angular resolution. Otherwise, the highest LOD is always used. Disabled by default.")
+                    ->DataElement(
+                        AZ::Edit::UIHandlers::Default,
+                        &LodSelectionConfiguration::m_trianglesPerHit,
+                        "Triangles Per Hit",
+                        "Minimal number of triangles per expected lidar hit. The coarsest LOD satisfying this condition is selected.")
+                    ->Attribute(AZ::Edit::Attributes::Min, 0.0f)
+                    ->DataElement(
+                        AZ::Edit::UIHandlers::Default,
+                        &LodSelectionConfiguration::m_hysteresis,
+                        "Hysteresis",
+                        "Fraction of the distance by which an entity has to move away from a lidar before a coarser LOD is selected.")
+                    ->Attribute(AZ::Edit::Attributes::Min, 0.0f);
+            }
+        }
+    }
+
+    void StaticBatchingConfiguration::Reflect(AZ::ReflectContext* context)
+    {
+        if (auto* serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
+        {
+            serializeContext->Class<StaticBatchingConfiguration>()
+                ->Version(0)
+                ->Field("Enabled", &StaticBatchingConfiguration::m_isEnabled)
+                ->Field("StaticTime", &StaticBatchingConfiguration::m_staticTime)
+                ->Field("RegionSize", &StaticBatchingConfiguration::m_regionSize)
+                ->Field("NonResidentTime", &StaticBatchingConfiguration::m_nonResidentTime)
+                ->Field("MaxRebuildsPerTick", &StaticBatchingConfiguration::m_maxRebuildsPerTick);
+
+            if (auto* editContext = serializeContext->GetEditContext())
+            {
+                editContext->Class<StaticBatchingConfiguration>("RGL Static Batching Configuration", "")
+                    ->DataElement(
+                        AZ::Edit::UIHandlers::Default,
+                        &StaticBatchingConfiguration::m_isEnabled,
+                        "Enabled",
+                        "If enabled, meshes of static entities are merged into combined RGL meshes, "
+                        "which reduces the number of RGL entities. Disabled by default.")
+                    ->DataElement(
+                        AZ::Edit::UIHandlers::Default,
+                        &StaticBatchingConfiguration::m_staticTime,
+                        "Static Time",
+                        "Time (in seconds) an entity has to remain unchanged before it is merged. "
+                        "Entities with a static transform are merged immediately.")
+                    ->Attribute(AZ::Edit::Attributes::Min, 0.0f)
+                    ->DataElement(
+                        AZ::Edit::UIHandlers::Default,
+                        &StaticBatchingConfiguration::m_regionSize,
+                        "Region Size",
+                        "Size (in meters) of the square regions within which entities are merged together.")
+                    ->Attribute(AZ::Edit::Attributes::Min, 1.0f)
+                    ->DataElement(
+                        AZ::Edit::UIHandlers::Default,
+                        &StaticBatchingConfiguration::m_nonResidentTime,
+                        "Non-Resident Time",
+                        "Time (in seconds) a merged entity may remain out of the geometry streaming range before it is split out "
+                        "of its merged meshes. Prevents rebuilding the merged meshes when entities stay close to the range.")
+                    ->Attribute(AZ::Edit::Attributes::Min, 0.0f)
+                    ->DataElement(
+                        AZ::Edit::UIHandlers::Default,
+                        &StaticBatchingConfiguration::m_maxRebuildsPerTick,
+                        "Max Rebuilds Per Tick",
+                        "Maximal number of merged meshes rebuilt in a single tick (0 for no limit). "
+                        "The remaining meshes keep their previous geometry until they are rebuilt in the following ticks.");
+            }
+        }
+    }
+
+    void MaterialTextureConfiguration::Reflect(AZ::ReflectContext* context)
+    {
+        if (auto* serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
+        {
+            serializeContext->Class<MaterialTextureConfiguration>()
+                ->Version(0)
+                ->Field("MaxTexelCount", &MaterialTextureConfiguration::m_maxTexelCount)
+                ->Field("UniformityTolerance", &MaterialTextureConfiguration::m_uniformityTolerance);
+
+            if (auto* editContext = serializeContext->GetEditContext())
+            {
+                editContext->Class<MaterialTextureConfiguration>("RGL Material Texture Configuration", "")
+                    ->DataElement(
+                        AZ::Edit::UIHandlers::Default,
+                        &MaterialTextureConfiguration::m_maxTexelCount,
+                        "Max Texel Count",
+                        "Maximal number of texels of an intensity texture created from a material image. "
+                        "Lower resolution mips are used for images exceeding it. Set to 0 to always use the full resolution.")
+                    ->DataElement(
+                        AZ::Edit::UIHandlers::Default,
+                        &MaterialTextureConfiguration::m_uniformityTolerance,
+                        "Uniformity Tolerance",
+                        "Intensity textures with all texel values (in range [0, 255]) differing by no more than this value "
+                        "are replaced with a single texel of their mean value.");
+            }
+        }
+    }
+
+    void AnimationLodConfiguration::Reflect(AZ::ReflectContext* context)
+    {
+        if (auto* serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
+        {
+            serializeContext->Class<AnimationLodConfiguration>()
+                ->Version(0)
+                ->Field("Enabled", &AnimationLodConfiguration::m_isEnabled)
+                ->Field("UpdateRateDivisor", &AnimationLodConfiguration::m_updateRateDivisor)
+                ->Field("FreezeDistance", &AnimationLodConfiguration::m_freezeDistance);
+
+            if (auto* editContext = serializeContext->GetEditContext())
+            {
+                editContext->Class<AnimationLodConfiguration>("RGL Animation LOD Configuration", "")
+                    ->DataElement(
+                        AZ::Edit::UIHandlers::Default,
+                        &AnimationLodConfiguration::m_isEnabled,
+                        "Enabled",
+                        "If enabled, skinned meshes are updated based on the distance to the nearest lidar. "
+                        "Skinned meshes outside the range of all lidars are not updated at all. Disabled by default.")
+                    ->DataElement(
+                        AZ::Edit::UIHandlers::Default,
+                        &AnimationLodConfiguration::m_updateRateDivisor,
+                        "Update Rate Divisor",
+                        "Skinned meshes are updated once every this many scene updates.")
+                    ->Attribute(AZ::Edit::Attributes::Min, 1U)
+                    ->DataElement(
+                        AZ::Edit::UIHandlers::Default,
+                        &AnimationLodConfiguration::m_freezeDistance,
+                        "Freeze Distance",
+                        "Distance (in meters) to the nearest lidar beyond which the pose of skinned meshes is frozen.")
+                    ->Attribute(AZ::Edit::Attributes::Min, 0.0f);
             }
         }
     }
 
     void SceneConfiguration::Reflect(AZ::ReflectContext* context)
     {
+        SurfaceTagIntensity::Reflect(context);
         TerrainIntensityConfiguration::Reflect(context);
+        TerrainMeshConfiguration::Reflect(context);
+        GeometryStreamingConfiguration::Reflect(context);
+        LodSelectionConfiguration::Reflect(context);
+        StaticBatchingConfiguration::Reflect(context);
+        MaterialTextureConfiguration::Reflect(context);
+        AnimationLodConfiguration::Reflect(context);
 
         if (auto* serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
         {
             serializeContext->Class<SceneConfiguration>()
                 ->Version(0)
                 ->Field("TerrainIntensityConfig", &SceneConfiguration::m_terrainIntensityConfig)
+                ->Field("TerrainMeshConfig", &SceneConfiguration::m_terrainMeshConfig)
+                ->Field("GeometryStreamingConfig", &SceneConfiguration::m_geometryStreamingConfig)
+                ->Field("LodSelectionConfig", &SceneConfiguration::m_lodSelectionConfig)
+                ->Field("StaticBatchingConfig", &SceneConfiguration::m_staticBatchingConfig)
+                ->Field("MaterialTextureConfig", &SceneConfiguration::m_materialTextureConfig)
+                ->Field("AnimationLodConfig", &SceneConfiguration::m_animationLodConfig)
+                ->Field("ColliderGeometry", &SceneConfiguration::m_isColliderGeometryEnabled)
                 ->Field("SkinnedMeshUpdate", &SceneConfiguration::m_isSkinnedMeshUpdateEnabled);
 
             if (auto* editContext = serializeContext->GetEditContext())
@@ -68,6 +334,34 @@ namespace RGL
                 editContext->Class<SceneConfiguration>("RGL Scene Configuration", "")
                     ->DataElement(
                         AZ::Edit::UIHandlers::Default, &SceneConfiguration::m_terrainIntensityConfig, "Terrain Intensity Configuration", "")
+                    ->DataElement(
+                        AZ::Edit::UIHandlers::Default, &SceneConfiguration::m_terrainMeshConfig, "Terrain Mesh Configuration", "")
+                    ->DataElement(
+                        AZ::Edit::UIHandlers::Default,
+                        &SceneConfiguration::m_geometryStreamingConfig,
+                        "Geometry Streaming Configuration",
+                        "")
+                    ->DataElement(
+                        AZ::Edit::UIHandlers::Default, &SceneConfiguration::m_lodSelectionConfig, "LOD Selection Configuration", "")
+                    ->DataElement(
+                        AZ::Edit::UIHandlers::Default,
+                        &SceneConfiguration::m_staticBatchingConfig,
+                        "Static Batching Configuration",
+                        "")
+                    ->DataElement(
+                        AZ::Edit::UIHandlers::Default,
+                        &SceneConfiguration::m_materialTextureConfig,
+                        "Material Texture Configuration",
+                        "")
+                    ->DataElement(
+                        AZ::Edit::UIHandlers::Default, &SceneConfiguration::m_animationLodConfig, "Animation LOD Configuration", "")
+                    ->DataElement(
+                        AZ::Edit::UIHandlers::Default,
+                        &SceneConfiguration::m_isColliderGeometryEnabled,
+                        "Collider Geometry",
+                        "If enabled, entities with physics colliders are represented by the collider geometry instead of the render mesh. "
+                        "Entities with colliders only become visible to lidars as well. "
+                        "Can be overridden per entity with the RGL Raycast Geometry component.")
                     ->DataElement(
                         AZ::Edit::UIHandlers::Default,
                         &SceneConfiguration::m_isSkinnedMeshUpdateEnabled,
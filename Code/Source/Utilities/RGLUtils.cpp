@@ -6,12 +6,24 @@
  *
  */
 #include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Component/Component.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Jobs/JobManager.h>
+#include <AzCore/std/algorithm.h>
 #include <AzCore/std/containers/unordered_set.h>
 #include <AzCore/std/string/conversions.h>
 #include <Utilities/RGLUtils.h>
 #include <iostream>
 #include <rgl/api/core.h>
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#endif
+
 namespace RGL::Utils
 {
     static constexpr AZ::u8 RglEntityIdBits = 28;
@@ -98,6 +110,60 @@ namespace RGL::Utils
         }
     }
 
+    bool HasProvidedService(const AZ::Entity& entity, AZ::Crc32 service)
+    {
+        AZ::ComponentDescriptor::DependencyArrayType providedServices;
+        for (const AZ::Component* component : entity.GetComponents())
+        {
+            AZ::ComponentDescriptor* descriptor = nullptr;
+            AZ::ComponentDescriptorBus::EventResult(
+                descriptor, component->RTTI_GetType(), &AZ::ComponentDescriptorBus::Events::GetDescriptor);
+            if (!descriptor)
+            {
+                continue;
+            }
+
+            providedServices.clear();
+            descriptor->GetProvidedServices(providedServices, component);
+            if (AZStd::find(providedServices.begin(), providedServices.end(), service) != providedServices.end())
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    void ParallelFor(size_t count, size_t minChunkSize, const AZStd::function<void(size_t begin, size_t end)>& function)
+    {
+        AZ::JobContext* jobContext = AZ::JobContext::GetGlobalContext();
+        const size_t workerCount = jobContext ? jobContext->GetJobManager().GetNumWorkerThreads() : 1U;
+        const size_t chunkCount = AZStd::min(workerCount, (count + minChunkSize - 1U) / AZStd::max(minChunkSize, size_t{ 1U }));
+        if (chunkCount <= 1U)
+        {
+            function(0U, count);
+            return;
+        }
+
+        AZ::JobCompletion completion(jobContext);
+        const size_t chunkSize = (count + chunkCount - 1U) / chunkCount;
+        for (size_t begin = 0U; begin < count; begin += chunkSize)
+        {
+            const size_t end = AZStd::min(begin + chunkSize, count);
+            AZ::Job* job = AZ::CreateJobFunction(
+                [&function, begin, end]()
+                {
+                    function(begin, end);
+                },
+                true,
+                jobContext);
+            job->SetDependent(&completion);
+            job->Start();
+        }
+
+        completion.StartAndWaitForCompletion();
+    }
+
     rgl_mat3x4f RglMat3x4FromAzMatrix3x4(const AZ::Matrix3x4& azMatrix)
     {
         return {
@@ -129,6 +195,104 @@ namespace RGL::Utils
         return { azVector.GetX(), azVector.GetY(), azVector.GetZ() };
     }
 
+    void RglVec3fsFromAzVector3s(AZStd::span<const AZ::Vector3> azVectors, rgl_vec3f* rglVectors)
+    {
+        size_t vectorIdx = 0U;
+#if defined(__SSE2__) || (defined(__ARM_NEON) && defined(__aarch64__))
+        if constexpr (sizeof(AZ::Vector3) == 4U * sizeof(float))
+        {
+            const auto* src = reinterpret_cast<const float*>(azVectors.data());
+            auto* dst = reinterpret_cast<float*>(rglVectors);
+            for (; vectorIdx + 4U <= azVectors.size(); vectorIdx += 4U, src += 16U, dst += 12U)
+            {
+#if defined(__SSE2__)
+                const __m128 a = _mm_loadu_ps(src);
+                const __m128 b = _mm_loadu_ps(src + 4U);
+                const __m128 c = _mm_loadu_ps(src + 8U);
+                const __m128 d = _mm_loadu_ps(src + 12U);
+                // (a.x, a.y, a.z, b.x), (b.y, b.z, c.x, c.y), (c.z, d.x, d.y, d.z)
+                const __m128 azbx = _mm_shuffle_ps(a, b, _MM_SHUFFLE(0, 0, 2, 2));
+                const __m128 czdx = _mm_shuffle_ps(c, d, _MM_SHUFFLE(0, 0, 2, 2));
+                _mm_storeu_ps(dst, _mm_shuffle_ps(a, azbx, _MM_SHUFFLE(2, 0, 1, 0)));
+                _mm_storeu_ps(dst + 4U, _mm_shuffle_ps(b, c, _MM_SHUFFLE(1, 0, 2, 1)));
+                _mm_storeu_ps(dst + 8U, _mm_shuffle_ps(czdx, d, _MM_SHUFFLE(2, 1, 2, 0)));
+#else
+                const float32x4x4_t components = vld4q_f32(src);
+                vst3q_f32(dst, float32x4x3_t{ { components.val[0], components.val[1], components.val[2] } });
+#endif
+            }
+        }
+#endif
+
+        for (; vectorIdx < azVectors.size(); ++vectorIdx)
+        {
+            rglVectors[vectorIdx] = RglVector3FromAzVec3f(azVectors[vectorIdx]);
+        }
+    }
+
+    void RglVec3fsFromComponents(float x, const float* ys, const float* zs, size_t count, rgl_vec3f* rglVectors)
+    {
+        size_t vectorIdx = 0U;
+#if defined(__SSE2__) || (defined(__ARM_NEON) && defined(__aarch64__))
+        auto* dst = reinterpret_cast<float*>(rglVectors);
+        for (; vectorIdx + 4U <= count; vectorIdx += 4U, dst += 12U)
+        {
+#if defined(__SSE2__)
+            const __m128 xs = _mm_set1_ps(x);
+            const __m128 y = _mm_loadu_ps(ys + vectorIdx);
+            const __m128 z = _mm_loadu_ps(zs + vectorIdx);
+            // (x, y0, z0, x), (y1, z1, x, y2), (z2, x, y3, z3)
+            const __m128 xy01 = _mm_unpacklo_ps(xs, y);
+            const __m128 xy23 = _mm_unpackhi_ps(xs, y);
+            const __m128 yz01 = _mm_unpacklo_ps(y, z);
+            const __m128 yz23 = _mm_unpackhi_ps(y, z);
+            const __m128 zx01 = _mm_unpacklo_ps(z, xs);
+            const __m128 zx23 = _mm_unpackhi_ps(z, xs);
+            _mm_storeu_ps(dst, _mm_shuffle_ps(xy01, zx01, _MM_SHUFFLE(1, 0, 1, 0)));
+            _mm_storeu_ps(dst + 4U, _mm_shuffle_ps(yz01, xy23, _MM_SHUFFLE(1, 0, 3, 2)));
+            _mm_storeu_ps(dst + 8U, _mm_shuffle_ps(zx23, yz23, _MM_SHUFFLE(3, 2, 1, 0)));
+#else
+            vst3q_f32(dst, float32x4x3_t{ { vdupq_n_f32(x), vld1q_f32(ys + vectorIdx), vld1q_f32(zs + vectorIdx) } });
+#endif
+        }
+#endif
+
+        for (; vectorIdx < count; ++vectorIdx)
+        {
+            rglVectors[vectorIdx] = rgl_vec3f{ x, ys[vectorIdx], zs[vectorIdx] };
+        }
+    }
+
+    void RglVec2fsFromComponents(
+        float sharedComponent, const float* components, size_t count, bool isSharedComponentFirst, rgl_vec2f* rglVectors)
+    {
+        size_t vectorIdx = 0U;
+#if defined(__SSE2__) || (defined(__ARM_NEON) && defined(__aarch64__))
+        auto* dst = reinterpret_cast<float*>(rglVectors);
+        for (; vectorIdx + 4U <= count; vectorIdx += 4U, dst += 8U)
+        {
+#if defined(__SSE2__)
+            const __m128 shared = _mm_set1_ps(sharedComponent);
+            const __m128 component = _mm_loadu_ps(components + vectorIdx);
+            const __m128 first = isSharedComponentFirst ? shared : component;
+            const __m128 second = isSharedComponentFirst ? component : shared;
+            _mm_storeu_ps(dst, _mm_unpacklo_ps(first, second));
+            _mm_storeu_ps(dst + 4U, _mm_unpackhi_ps(first, second));
+#else
+            const float32x4_t shared = vdupq_n_f32(sharedComponent);
+            const float32x4_t component = vld1q_f32(components + vectorIdx);
+            vst2q_f32(dst, isSharedComponentFirst ? float32x4x2_t{ { shared, component } } : float32x4x2_t{ { component, shared } });
+#endif
+        }
+#endif
+
+        for (; vectorIdx < count; ++vectorIdx)
+        {
+            rglVectors[vectorIdx] = isSharedComponentFirst ? rgl_vec2f{ sharedComponent, components[vectorIdx] }
+                                                           : rgl_vec2f{ components[vectorIdx], sharedComponent };
+        }
+    }
+
     rgl_vec2f RglVec2fFromAzVector2(const AZ::Vector2& azVector)
     {
         return { azVector.GetX(), azVector.GetY() };
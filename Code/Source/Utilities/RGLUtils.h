@@ -7,7 +7,11 @@
  */
 #pragma once
 
+#include <AzCore/Component/Entity.h>
+#include <AzCore/Math/Crc.h>
 #include <AzCore/Math/Matrix3x4.h>
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/function/function_template.h>
 #include <ROS2Sensors/Lidar/RaycastResults.h>
 #include <rgl/api/core.h>
 
@@ -39,10 +43,31 @@ namespace RGL::Utils
     //! Each status returned by RGL API should be passed to it.
 #define RGL_CHECK(x) RGL::Utils::ErrorCheck(x, __FILE__, __LINE__)
 
+    //! Returns true if any component of the entity provides the service.
+    //! Can be used on entities which are not activated yet.
+    bool HasProvidedService(const AZ::Entity& entity, AZ::Crc32 service);
+
+    //! Splits the range [0, count) into chunks processed by jobs and waits until all of them are processed.
+    //! The calling thread assists in processing the jobs, so the function can be called from within a job as well.
+    //! @param minChunkSize Minimal number of elements processed by a single job.
+    //! @param function Function processing the elements in the range [begin, end).
+    void ParallelFor(size_t count, size_t minChunkSize, const AZStd::function<void(size_t begin, size_t end)>& function);
+
     rgl_mat3x4f RglMat3x4FromAzMatrix3x4(const AZ::Matrix3x4& azMatrix);
     AZ::Matrix3x4 AzMatrix3x4FromRglMat3x4(const rgl_mat3x4f& rglMatrix);
     AZ::Vector3 AzVector3FromRglVec3f(const rgl_vec3f& rglVector);
     rgl_vec3f RglVector3FromAzVec3f(const AZ::Vector3& azVector);
+    //! Converts AZ vectors (padded to four components) into tightly packed RGL vectors, four vectors at a time.
+    //! @param rglVectors Destination buffer of at least azVectors.size() vectors.
+    void RglVec3fsFromAzVector3s(AZStd::span<const AZ::Vector3> azVectors, rgl_vec3f* rglVectors);
+    //! Packs RGL vectors sharing the x component from separate arrays of the y and z components, four vectors at a time.
+    //! @param rglVectors Destination buffer of at least count vectors.
+    void RglVec3fsFromComponents(float x, const float* ys, const float* zs, size_t count, rgl_vec3f* rglVectors);
+    //! Packs RGL vectors with one component shared by all vectors and the other one taken from an array, four vectors at a time.
+    //! @param isSharedComponentFirst If true, the shared component is the first component of the vectors, otherwise the second one.
+    //! @param rglVectors Destination buffer of at least count vectors.
+    void RglVec2fsFromComponents(
+        float sharedComponent, const float* components, size_t count, bool isSharedComponentFirst, rgl_vec2f* rglVectors);
     rgl_vec2f RglVec2fFromAzVector2(const AZ::Vector2& azVector);
 
     constexpr rgl_mat3x4f IdentityTransform{
@@ -0,0 +1,143 @@
+/* Copyright 2024, Robotec.ai sp. z o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/parallel/scoped_lock.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/std/utils.h>
+
+namespace RGL::Utils
+{
+    //! Pool of buffers handed over to posted RGL commands without copying.
+    //! A buffer is filled by the thread acquiring it, then shared with the commands reading it and returned to the pool
+    //! once the last reference to it is released. The buffers keep their capacity, so no buffers are allocated once the pool
+    //! holds as many buffers as are referenced at once.
+    template<typename T>
+    class RglBufferPool
+    {
+        struct Buffer
+        {
+            AZStd::vector<T> m_data;
+            AZStd::atomic<AZ::u32> m_referenceCount{ 0U };
+        };
+
+    public:
+        //! Reference counted handle of a pooled buffer.
+        //! The buffer may only be modified through the handle returned by Acquire, before the handle is copied.
+        class BufferPtr
+        {
+        public:
+            BufferPtr() = default;
+
+            BufferPtr(const BufferPtr& other)
+                : m_buffer(other.m_buffer)
+            {
+                if (m_buffer)
+                {
+                    m_buffer->m_referenceCount.fetch_add(1U, AZStd::memory_order_relaxed);
+                }
+            }
+
+            BufferPtr(BufferPtr&& other)
+                : m_buffer(AZStd::exchange(other.m_buffer, nullptr))
+            {
+            }
+
+            ~BufferPtr()
+            {
+                Reset();
+            }
+
+            //! Releases the reference. The last reference returns the buffer to the pool.
+            void Reset()
+            {
+                // Acquire-release ordering makes all reads of the buffer happen before it is reused.
+                Buffer* buffer = AZStd::exchange(m_buffer, nullptr);
+                if (buffer && buffer->m_referenceCount.fetch_sub(1U, AZStd::memory_order_acq_rel) == 1U)
+                {
+                    RglBufferPool::Get().Recycle(buffer);
+                }
+            }
+
+            [[nodiscard]] explicit operator bool() const
+            {
+                return m_buffer;
+            }
+
+            AZStd::vector<T>& operator*() const
+            {
+                return m_buffer->m_data;
+            }
+
+            AZStd::vector<T>* operator->() const
+            {
+                return &m_buffer->m_data;
+            }
+
+            BufferPtr& operator=(BufferPtr other)
+            {
+                AZStd::swap(m_buffer, other.m_buffer);
+                return *this;
+            }
+
+        private:
+            friend class RglBufferPool;
+
+            explicit BufferPtr(Buffer* buffer)
+                : m_buffer(buffer)
+            {
+                m_buffer->m_referenceCount.store(1U, AZStd::memory_order_relaxed);
+            }
+
+            Buffer* m_buffer{ nullptr };
+        };
+
+        static RglBufferPool& Get()
+        {
+            static RglBufferPool pool;
+            return pool;
+        }
+
+        //! Returns a buffer not referenced anywhere else. Its contents are unspecified.
+        BufferPtr Acquire()
+        {
+            {
+                AZStd::scoped_lock lock(m_mutex);
+                if (!m_freeBuffers.empty())
+                {
+                    Buffer* buffer = m_freeBuffers.back().release();
+                    m_freeBuffers.pop_back();
+                    return BufferPtr(buffer);
+                }
+            }
+
+            return BufferPtr(new Buffer());
+        }
+
+    private:
+        void Recycle(Buffer* buffer)
+        {
+            AZStd::scoped_lock lock(m_mutex);
+            m_freeBuffers.emplace_back(buffer);
+        }
+
+        AZStd::mutex m_mutex;
+        AZStd::vector<AZStd::unique_ptr<Buffer>> m_freeBuffers;
+    };
+} // namespace RGL::Utils
@@ -0,0 +1,108 @@
+/* Copyright 2024, Robotec.ai sp. z o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <Utilities/RglExecutor.h>
+
+namespace RGL
+{
+    RglExecutor::RglExecutor()
+    {
+        // The queue always contains at least one node, so that the producers never touch the tail.
+        m_tail = new Command;
+        m_head.store(m_tail, AZStd::memory_order_relaxed);
+
+        AZStd::thread_desc threadDesc;
+        threadDesc.m_name = "RGL Executor";
+        m_thread = AZStd::thread(
+            threadDesc,
+            [this]()
+            {
+                Run();
+            });
+    }
+
+    RglExecutor::~RglExecutor()
+    {
+        // An empty command stops the thread once all previously submitted commands are executed.
+        Push(new Command);
+        m_thread.join();
+
+        delete m_tail;
+    }
+
+    void RglExecutor::Post(AZStd::function<void()> command)
+    {
+        AZ_Assert(command, "Tried to post an empty RGL command.");
+        auto* node = new Command;
+        node->m_function = AZStd::move(command);
+        Push(node);
+    }
+
+    bool RglExecutor::IsExecutorThread() const
+    {
+        return AZStd::this_thread::get_id() == m_thread.get_id();
+    }
+
+    void RglExecutor::Push(Command* command)
+    {
+        Command* previous = m_head.exchange(command, AZStd::memory_order_acq_rel);
+        previous->m_next.store(command, AZStd::memory_order_release);
+        m_pendingCommandCount.release();
+    }
+
+    AZStd::function<void()> RglExecutor::Pop()
+    {
+        // The command was counted, but another producer may still be linking the preceding node.
+        Command* next = m_tail->m_next.load(AZStd::memory_order_acquire);
+        while (!next)
+        {
+            AZStd::this_thread::yield();
+            next = m_tail->m_next.load(AZStd::memory_order_acquire);
+        }
+
+        delete m_tail;
+        m_tail = next;
+        return AZStd::move(next->m_function);
+    }
+
+    void RglExecutor::Run()
+    {
+        while (true)
+        {
+            m_pendingCommandCount.acquire();
+            AZStd::function<void()> command = Pop();
+            if (!command)
+            {
+                return;
+            }
+
+            command();
+        }
+    }
+
+    namespace Utils
+    {
+        void PostRglCommand(AZStd::function<void()> command)
+        {
+            RglExecutor* executor = RglExecutorInterface::Get();
+            if (!executor || executor->IsExecutorThread())
+            {
+                command();
+                return;
+            }
+
+            executor->Post(AZStd::move(command));
+        }
+    } // namespace Utils
+} // namespace RGL
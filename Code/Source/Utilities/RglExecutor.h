@@ -0,0 +1,126 @@
+/* Copyright 2024, Robotec.ai sp. z o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/RTTI/RTTI.h>
+#include <AzCore/std/function/function_template.h>
+#include <AzCore/std/optional.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/semaphore.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/typetraits/invoke_traits.h>
+#include <AzCore/std/typetraits/typetraits.h>
+
+namespace RGL
+{
+    //! Thread owning all RGL API calls, since the RGL API is not thread-safe.
+    //! Commands are submitted through a lock-free multiple-producer single-consumer queue and executed in the submission order.
+    //! Commands without results (e.g. entity transform or vertex updates) own their data (see RglBufferPool) and do not block
+    //! the submitting thread. Only commands returning RGL handles or results are waited for.
+    class RglExecutor
+    {
+    public:
+        AZ_RTTI(RglExecutor, "{a36e8888-9d92-447f-ba81-25f455192501}");
+
+        RglExecutor();
+        RglExecutor(const RglExecutor& other) = delete;
+        //! Executes all commands submitted so far and stops the thread.
+        virtual ~RglExecutor();
+
+        //! Enqueues the command without waiting for its execution.
+        void Post(AZStd::function<void()> command);
+
+        //! Enqueues the function and waits until it is executed. Has to be called from outside of the executor thread.
+        //! @return Result of the function.
+        template<typename FunctionT>
+        AZStd::invoke_result_t<FunctionT> Execute(FunctionT&& function)
+        {
+            using ResultT = AZStd::invoke_result_t<FunctionT>;
+            AZ_Assert(!IsExecutorThread(), "RGL commands executed from the executor thread would wait for themselves.");
+
+            // The function and its result live on the stack of the waiting thread.
+            AZStd::semaphore completion;
+            if constexpr (AZStd::is_void_v<ResultT>)
+            {
+                Post(
+                    [&function, &completion]()
+                    {
+                        function();
+                        completion.release();
+                    });
+                completion.acquire();
+            }
+            else
+            {
+                AZStd::optional<ResultT> result;
+                Post(
+                    [&function, &result, &completion]()
+                    {
+                        result.emplace(function());
+                        completion.release();
+                    });
+                completion.acquire();
+                return AZStd::move(result.value());
+            }
+        }
+
+        //! Returns true if called from the executor thread.
+        [[nodiscard]] bool IsExecutorThread() const;
+
+        RglExecutor& operator=(const RglExecutor& other) = delete;
+
+    private:
+        //! Node of the intrusive queue. The last popped node stays in the queue as its tail.
+        struct Command
+        {
+            AZStd::atomic<Command*> m_next{ nullptr };
+            AZStd::function<void()> m_function;
+        };
+
+        void Push(Command* command);
+        //! Removes the oldest command from the queue. Has to be called from the executor thread once per released semaphore count.
+        AZStd::function<void()> Pop();
+        void Run();
+
+        AZStd::atomic<Command*> m_head{ nullptr }; //!< Most recently pushed command. Exchanged by the producers.
+        Command* m_tail{ nullptr }; //!< Only accessed by the executor thread.
+        AZStd::semaphore m_pendingCommandCount;
+        AZStd::thread m_thread;
+    };
+
+    using RglExecutorInterface = AZ::Interface<RglExecutor>;
+
+    namespace Utils
+    {
+        //! Executes the function on the RGL executor thread and waits for its result.
+        //! The function is executed in place if called from the executor thread or if no executor is registered.
+        template<typename FunctionT>
+        auto ExecuteRglCommand(FunctionT&& function)
+        {
+            RglExecutor* executor = RglExecutorInterface::Get();
+            if (!executor || executor->IsExecutorThread())
+            {
+                return function();
+            }
+
+            return executor->Execute(AZStd::forward<FunctionT>(function));
+        }
+
+        //! Executes the command on the RGL executor thread without waiting for it.
+        //! The command is executed in place if called from the executor thread or if no executor is registered.
+        void PostRglCommand(AZStd::function<void()> command);
+    } // namespace Utils
+} // namespace RGL
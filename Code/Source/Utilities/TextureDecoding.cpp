@@ -0,0 +1,607 @@
+/* Copyright 2024, Robotec.ai sp. z o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/containers/array.h>
+#include <Utilities/RGLUtils.h>
+#include <Utilities/TextureDecoding.h>
+
+#if defined(__SSSE3__)
+#include <tmmintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#endif
+
+namespace RGL::Utils
+{
+    namespace
+    {
+        constexpr size_t BlockDim = 4U;
+        constexpr size_t BlockTexelCount = BlockDim * BlockDim;
+        //! Minimal number of texel rows decoded by a single job.
+        constexpr size_t MinTexelRowsPerJob = 64U;
+
+        using BlockTexels = AZStd::array<uint8_t, BlockTexelCount>;
+        //! Palette of luminance values, padded to the width of a SIMD register.
+        using Palette = AZStd::array<uint8_t, 16U>;
+
+        //! Luminance weights (scaled by 256) matching the luminosity method used for material colors.
+        constexpr uint32_t RedLuminanceWeight = 77U;
+        constexpr uint32_t GreenLuminanceWeight = 150U;
+        constexpr uint32_t BlueLuminanceWeight = 29U;
+
+        //! Indices of the four texels of a BC1 block row, for each value of the row byte.
+        constexpr auto Bc1RowIndices = []()
+        {
+            AZStd::array<AZStd::array<uint8_t, BlockDim>, 256U> rowIndices{};
+            for (size_t rowByte = 0U; rowByte < rowIndices.size(); ++rowByte)
+            {
+                for (size_t x = 0U; x < BlockDim; ++x)
+                {
+                    rowIndices[rowByte][x] = static_cast<uint8_t>((rowByte >> (2U * x)) & 0b11U);
+                }
+            }
+            return rowIndices;
+        }();
+
+        //! Subsets of texels in BC7 blocks with two subsets, one bit per texel, for each partition.
+        constexpr AZStd::array<uint16_t, 64U> Bc7TwoSubsetPartitions{
+            0xCCCC, 0x8888, 0xEEEE, 0xECC8, 0xC880, 0xFEEC, 0xFEC8, 0xEC80, 0xC800, 0xFFEC, 0xFE80, 0xE800, 0xFFE8, 0xFF00, 0xFFF0, 0xF000,
+            0xF710, 0x008E, 0x7100, 0x08CE, 0x008C, 0x7310, 0x3100, 0x8CCE, 0x088C, 0x3110, 0x6666, 0x366C, 0x17E8, 0x0FF0, 0x718E, 0x399C,
+            0xAAAA, 0xF0F0, 0x5A5A, 0x33CC, 0x3C3C, 0x55AA, 0x9696, 0xA55A, 0x73CE, 0x13C8, 0x324C, 0x3BDC, 0x6996, 0xC33C, 0x9966, 0x0660,
+            0x0272, 0x04E4, 0x4E40, 0x2720, 0xC936, 0x936C, 0x39C6, 0x639C, 0x9336, 0x9CC6, 0x817E, 0xE718, 0xCCF0, 0x0FCC, 0x7744, 0xEE22,
+        };
+
+        //! Subsets of texels in BC7 blocks with three subsets, two bits per texel, for each partition.
+        constexpr AZStd::array<uint32_t, 64U> Bc7ThreeSubsetPartitions{
+            0xAA685050, 0x6A5A5040, 0x5A5A4200, 0x5450A0A8, 0xA5A50000, 0xA0A05050, 0x5555A0A0, 0x5A5A5050,
+            0xAA550000, 0xAA555500, 0xAAAA5500, 0x90909090, 0x94949494, 0xA4A4A4A4, 0xA9A59450, 0x2A0A4250,
+            0xA5945040, 0x0A425054, 0xA5A5A500, 0x55A0A0A0, 0xA8A85454, 0x6A6A4040, 0xA4A45000, 0x1A1A0500,
+            0x0050A4A4, 0xAAA59090, 0x14696914, 0x69691400, 0xA08585A0, 0xAA821414, 0x50A4A450, 0x6A5A0200,
+            0xA9A58000, 0x5090A0A8, 0xA8A09050, 0x24242424, 0x00AA5500, 0x24924924, 0x24499224, 0x50A50A50,
+            0x500AA550, 0xAAAA4444, 0x66660000, 0xA5A0A5A0, 0x50A050A0, 0x69286928, 0x44AAAA44, 0x66666600,
+            0xAA444444, 0x54A854A8, 0x95809580, 0x96969600, 0xA85454A8, 0x80959580, 0xAA141414, 0x96960000,
+            0xAAAA1414, 0xA05050A0, 0xA0A5A5A0, 0x96000000, 0x40804080, 0xA9A8A9A8, 0xAAAAAA44, 0x2A4A5254,
+        };
+
+        //! Anchor texel of the second subset in BC7 blocks with two subsets, for each partition.
+        constexpr AZStd::array<uint8_t, 64U> Bc7TwoSubsetAnchors{
+            15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 2, 8, 2, 2, 8, 8, 15, 2, 8, 2, 2, 8, 8, 2, 2,
+            15, 15, 6, 8, 2, 8, 15, 15, 2, 8, 2, 2, 2, 15, 15, 6, 6, 2, 6, 8, 15, 15, 2, 2, 15, 15, 15, 15, 15, 2, 2, 15,
+        };
+
+        //! Anchor texels of the second and the third subset in BC7 blocks with three subsets, for each partition.
+        constexpr AZStd::array<AZStd::array<uint8_t, 64U>, 2U> Bc7ThreeSubsetAnchors{ {
+            { 3, 3, 15, 15, 8, 3, 15, 15, 8, 8, 6, 6, 6, 5, 3, 3, 3, 3, 8, 15, 3, 3, 6, 10, 5, 8, 8, 6, 8, 5, 15, 15,
+              8, 15, 3, 5, 6, 10, 8, 15, 15, 3, 15, 5, 15, 15, 15, 15, 3, 15, 5, 5, 5, 8, 5, 10, 5, 10, 8, 13, 15, 12, 3, 3 },
+            { 15, 8, 8, 3, 15, 15, 3, 8, 15, 15, 15, 15, 15, 15, 15, 8, 15, 8, 15, 3, 15, 8, 15, 8, 3, 15, 6, 10, 15, 15, 10, 8,
+              15, 3, 15, 10, 10, 8, 9, 10, 6, 15, 8, 15, 3, 6, 6, 8, 15, 3, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 3, 15, 15, 8 },
+        } };
+
+        //! Interpolation weights (scaled by 64) of BC7 indices, for 2, 3 and 4 bit indices.
+        constexpr uint8_t Bc7Weights2[] = { 0, 21, 43, 64 };
+        constexpr uint8_t Bc7Weights3[] = { 0, 9, 18, 27, 37, 46, 55, 64 };
+        constexpr uint8_t Bc7Weights4[] = { 0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64 };
+
+        //! Layout of a BC7 block in one of the eight modes.
+        struct Bc7Mode
+        {
+            uint8_t m_subsetCount;
+            uint8_t m_partitionBits;
+            uint8_t m_rotationBits;
+            uint8_t m_indexSelectionBits;
+            uint8_t m_colorBits;
+            uint8_t m_alphaBits;
+            uint8_t m_endpointPBits; //!< Number of unique P-bits per endpoint.
+            uint8_t m_sharedPBits; //!< Number of P-bits shared by both endpoints of a subset.
+            uint8_t m_indexBits;
+            uint8_t m_secondaryIndexBits;
+        };
+
+        constexpr AZStd::array<Bc7Mode, 8U> Bc7Modes{ {
+            { 3, 4, 0, 0, 4, 0, 1, 0, 3, 0 },
+            { 2, 6, 0, 0, 6, 0, 0, 1, 3, 0 },
+            { 3, 6, 0, 0, 5, 0, 0, 0, 2, 0 },
+            { 2, 6, 0, 0, 7, 0, 1, 0, 2, 0 },
+            { 1, 0, 2, 1, 5, 6, 0, 0, 2, 3 },
+            { 1, 0, 2, 0, 7, 8, 0, 0, 2, 2 },
+            { 1, 0, 0, 0, 7, 7, 1, 0, 4, 0 },
+            { 2, 6, 0, 0, 5, 5, 1, 0, 2, 0 },
+        } };
+
+        //! Reads consecutive fields of a 128-bit block, starting from the least significant bit.
+        class BlockBitReader
+        {
+        public:
+            explicit BlockBitReader(const uint8_t* block)
+            {
+                memcpy(&m_low, block, sizeof(m_low));
+                memcpy(&m_high, block + sizeof(m_low), sizeof(m_high));
+            }
+
+            //! Reads a field of up to 32 bits.
+            uint32_t Read(uint32_t bitCount)
+            {
+                if (bitCount == 0U)
+                {
+                    return 0U;
+                }
+
+                const auto value = static_cast<uint32_t>(m_low & ((uint64_t{ 1U } << bitCount) - 1U));
+                m_low = (m_low >> bitCount) | (m_high << (64U - bitCount));
+                m_high >>= bitCount;
+                return value;
+            }
+
+        private:
+            uint64_t m_low{ 0U };
+            uint64_t m_high{ 0U };
+        };
+
+        uint8_t LuminanceFromRgb(uint32_t r, uint32_t g, uint32_t b)
+        {
+            return static_cast<uint8_t>((RedLuminanceWeight * r + GreenLuminanceWeight * g + BlueLuminanceWeight * b) >> 8U);
+        }
+
+        //! Returns the luminance scaled by 256, which keeps the precision for the interpolation of palette entries.
+        uint32_t ScaledLuminanceFromRgb565(uint16_t color)
+        {
+            const uint32_t r5 = (color >> 11U) & 0x1FU;
+            const uint32_t g6 = (color >> 5U) & 0x3FU;
+            const uint32_t b5 = color & 0x1FU;
+            const uint32_t r = (r5 << 3U) | (r5 >> 2U);
+            const uint32_t g = (g6 << 2U) | (g6 >> 4U);
+            const uint32_t b = (b5 << 3U) | (b5 >> 2U);
+            return RedLuminanceWeight * r + GreenLuminanceWeight * g + BlueLuminanceWeight * b;
+        }
+
+        //! Replaces each palette index with the palette value.
+        void LookUpPalette(const Palette& palette, const BlockTexels& indices, BlockTexels& texels)
+        {
+#if defined(__SSSE3__)
+            const __m128i paletteVec = _mm_loadu_si128(reinterpret_cast<const __m128i*>(palette.data()));
+            const __m128i indexVec = _mm_loadu_si128(reinterpret_cast<const __m128i*>(indices.data()));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(texels.data()), _mm_shuffle_epi8(paletteVec, indexVec));
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+            vst1q_u8(texels.data(), vqtbl1q_u8(vld1q_u8(palette.data()), vld1q_u8(indices.data())));
+#else
+            for (size_t i = 0U; i < BlockTexelCount; ++i)
+            {
+                texels[i] = palette[indices[i]];
+            }
+#endif
+        }
+
+        //! Decodes the color part of BC1, BC2 and BC3 blocks.
+        //! @tparam IsThreeColorModeSupported Only BC1 blocks switch to the three color mode if the first color is not greater.
+        template<bool IsThreeColorModeSupported>
+        void DecodeColorBlock(const uint8_t* block, BlockTexels& texels)
+        {
+            const uint16_t color0 = static_cast<uint16_t>(block[0] | (block[1] << 8U));
+            const uint16_t color1 = static_cast<uint16_t>(block[2] | (block[3] << 8U));
+            const uint32_t lum0 = ScaledLuminanceFromRgb565(color0);
+            const uint32_t lum1 = ScaledLuminanceFromRgb565(color1);
+
+            Palette palette{};
+            palette[0] = static_cast<uint8_t>(lum0 >> 8U);
+            palette[1] = static_cast<uint8_t>(lum1 >> 8U);
+            if (!IsThreeColorModeSupported || color0 > color1)
+            {
+                palette[2] = static_cast<uint8_t>(((2U * lum0 + lum1) / 3U) >> 8U);
+                palette[3] = static_cast<uint8_t>(((lum0 + 2U * lum1) / 3U) >> 8U);
+            }
+            else
+            {
+                // Three color mode, the last index denotes transparent black.
+                palette[2] = static_cast<uint8_t>(((lum0 + lum1) / 2U) >> 8U);
+                palette[3] = 0U;
+            }
+
+            BlockTexels indices;
+            for (size_t y = 0U; y < BlockDim; ++y)
+            {
+                AZStd::copy(Bc1RowIndices[block[4U + y]].begin(), Bc1RowIndices[block[4U + y]].end(), indices.begin() + y * BlockDim);
+            }
+
+            LookUpPalette(palette, indices, texels);
+        }
+
+        void DecodeBc1Block(const uint8_t* block, BlockTexels& texels)
+        {
+            DecodeColorBlock<true>(block, texels);
+        }
+
+        void DecodeBc3Block(const uint8_t* block, BlockTexels& texels)
+        {
+            // The alpha part (the first 8 bytes) does not affect the luminance.
+            DecodeColorBlock<false>(block + 8U, texels);
+        }
+
+        void DecodeBc4Block(const uint8_t* block, BlockTexels& texels)
+        {
+            const uint32_t value0 = block[0];
+            const uint32_t value1 = block[1];
+
+            Palette palette{};
+            palette[0] = static_cast<uint8_t>(value0);
+            palette[1] = static_cast<uint8_t>(value1);
+            if (value0 > value1)
+            {
+                for (uint32_t i = 1U; i < 7U; ++i)
+                {
+                    palette[i + 1U] = static_cast<uint8_t>(((7U - i) * value0 + i * value1) / 7U);
+                }
+            }
+            else
+            {
+                for (uint32_t i = 1U; i < 5U; ++i)
+                {
+                    palette[i + 1U] = static_cast<uint8_t>(((5U - i) * value0 + i * value1) / 5U);
+                }
+                palette[6] = 0U;
+                palette[7] = 255U;
+            }
+
+            uint64_t indexBits = 0U;
+            for (size_t i = 0U; i < 6U; ++i)
+            {
+                indexBits |= static_cast<uint64_t>(block[2U + i]) << (8U * i);
+            }
+
+            BlockTexels indices;
+            for (size_t i = 0U; i < BlockTexelCount; ++i)
+            {
+                indices[i] = static_cast<uint8_t>((indexBits >> (3U * i)) & 0b111U);
+            }
+
+            LookUpPalette(palette, indices, texels);
+        }
+
+        uint8_t Bc7Interpolate(uint32_t endpoint0, uint32_t endpoint1, uint32_t weight)
+        {
+            return static_cast<uint8_t>(((64U - weight) * endpoint0 + weight * endpoint1 + 32U) >> 6U);
+        }
+
+        const uint8_t* GetBc7Weights(uint32_t indexBits)
+        {
+            return indexBits == 2U ? Bc7Weights2 : (indexBits == 3U ? Bc7Weights3 : Bc7Weights4);
+        }
+
+        //! Expands an endpoint component of the provided precision to 8 bits.
+        uint32_t Bc7Unquantize(uint32_t value, uint32_t bitCount)
+        {
+            value <<= 8U - bitCount;
+            return value | (value >> bitCount);
+        }
+
+        void DecodeBc7Block(const uint8_t* block, BlockTexels& texels)
+        {
+            BlockBitReader bits(block);
+            uint32_t modeIdx = 0U;
+            while (modeIdx < Bc7Modes.size() && bits.Read(1U) == 0U)
+            {
+                ++modeIdx;
+            }
+
+            if (modeIdx == Bc7Modes.size())
+            {
+                // Reserved mode, decoded as transparent black.
+                texels.fill(0U);
+                return;
+            }
+
+            const Bc7Mode& mode = Bc7Modes[modeIdx];
+            const uint32_t partition = bits.Read(mode.m_partitionBits);
+            const uint32_t rotation = bits.Read(mode.m_rotationBits);
+            const uint32_t indexSelection = bits.Read(mode.m_indexSelectionBits);
+
+            // RGBA components of both endpoints of each subset.
+            const uint32_t endpointCount = 2U * mode.m_subsetCount;
+            AZStd::array<AZStd::array<uint32_t, 4U>, 6U> endpoints{};
+            for (uint32_t channel = 0U; channel < 3U; ++channel)
+            {
+                for (uint32_t endpoint = 0U; endpoint < endpointCount; ++endpoint)
+                {
+                    endpoints[endpoint][channel] = bits.Read(mode.m_colorBits);
+                }
+            }
+
+            for (uint32_t endpoint = 0U; endpoint < endpointCount && mode.m_alphaBits > 0U; ++endpoint)
+            {
+                endpoints[endpoint][3] = bits.Read(mode.m_alphaBits);
+            }
+
+            const bool hasPBits = mode.m_endpointPBits > 0U || mode.m_sharedPBits > 0U;
+            if (hasPBits)
+            {
+                AZStd::array<uint32_t, 6U> pBits{};
+                for (uint32_t endpoint = 0U; endpoint < endpointCount; endpoint += 2U)
+                {
+                    pBits[endpoint] = bits.Read(1U);
+                    pBits[endpoint + 1U] = mode.m_sharedPBits > 0U ? pBits[endpoint] : bits.Read(1U);
+                }
+
+                for (uint32_t endpoint = 0U; endpoint < endpointCount; ++endpoint)
+                {
+                    for (uint32_t& component : endpoints[endpoint])
+                    {
+                        component = (component << 1U) | pBits[endpoint];
+                    }
+                }
+            }
+
+            const uint32_t colorBits = mode.m_colorBits + (hasPBits ? 1U : 0U);
+            const uint32_t alphaBits = mode.m_alphaBits + (hasPBits && mode.m_alphaBits > 0U ? 1U : 0U);
+            for (uint32_t endpoint = 0U; endpoint < endpointCount; ++endpoint)
+            {
+                for (uint32_t channel = 0U; channel < 3U; ++channel)
+                {
+                    endpoints[endpoint][channel] = Bc7Unquantize(endpoints[endpoint][channel], colorBits);
+                }
+
+                endpoints[endpoint][3] = alphaBits > 0U ? Bc7Unquantize(endpoints[endpoint][3], alphaBits) : 255U;
+            }
+
+            BlockTexels subsets{};
+            for (uint32_t i = 0U; i < BlockTexelCount; ++i)
+            {
+                if (mode.m_subsetCount == 2U)
+                {
+                    subsets[i] = static_cast<uint8_t>((Bc7TwoSubsetPartitions[partition] >> i) & 0b1U);
+                }
+                else if (mode.m_subsetCount == 3U)
+                {
+                    subsets[i] = static_cast<uint8_t>((Bc7ThreeSubsetPartitions[partition] >> (2U * i)) & 0b11U);
+                }
+            }
+
+            // The most significant index bit of the anchor texel of each subset is implicitly zero.
+            const auto isAnchor = [&](uint32_t i)
+            {
+                return i == 0U || (mode.m_subsetCount == 2U && i == Bc7TwoSubsetAnchors[partition]) ||
+                    (mode.m_subsetCount == 3U && (i == Bc7ThreeSubsetAnchors[0][partition] || i == Bc7ThreeSubsetAnchors[1][partition]));
+            };
+
+            BlockTexels indices;
+            for (uint32_t i = 0U; i < BlockTexelCount; ++i)
+            {
+                indices[i] = static_cast<uint8_t>(bits.Read(mode.m_indexBits - (isAnchor(i) ? 1U : 0U)));
+            }
+
+            BlockTexels secondaryIndices = indices;
+            for (uint32_t i = 0U; i < BlockTexelCount && mode.m_secondaryIndexBits > 0U; ++i)
+            {
+                secondaryIndices[i] = static_cast<uint8_t>(bits.Read(mode.m_secondaryIndexBits - (i == 0U ? 1U : 0U)));
+            }
+
+            // Modes with secondary indices use them for the alpha, unless the index selection bit swaps both index sets.
+            const bool areIndicesSwapped = indexSelection != 0U;
+            const BlockTexels& colorIndices = areIndicesSwapped ? secondaryIndices : indices;
+            const BlockTexels& alphaIndices = areIndicesSwapped ? indices : secondaryIndices;
+            const uint8_t* colorWeights = GetBc7Weights(areIndicesSwapped ? mode.m_secondaryIndexBits : mode.m_indexBits);
+            const uint8_t* alphaWeights =
+                GetBc7Weights(mode.m_secondaryIndexBits > 0U && !areIndicesSwapped ? mode.m_secondaryIndexBits : mode.m_indexBits);
+
+            for (uint32_t i = 0U; i < BlockTexelCount; ++i)
+            {
+                const AZStd::array<uint32_t, 4U>& endpoint0 = endpoints[2U * subsets[i]];
+                const AZStd::array<uint32_t, 4U>& endpoint1 = endpoints[2U * subsets[i] + 1U];
+                AZStd::array<uint8_t, 4U> rgba;
+                for (uint32_t channel = 0U; channel < 3U; ++channel)
+                {
+                    rgba[channel] = Bc7Interpolate(endpoint0[channel], endpoint1[channel], colorWeights[colorIndices[i]]);
+                }
+
+                rgba[3] = Bc7Interpolate(endpoint0[3], endpoint1[3], alphaWeights[alphaIndices[i]]);
+                if (rotation > 0U)
+                {
+                    // The rotation swaps the alpha with one of the color channels.
+                    AZStd::swap(rgba[rotation - 1U], rgba[3]);
+                }
+
+                texels[i] = LuminanceFromRgb(rgba[0], rgba[1], rgba[2]);
+            }
+        }
+
+        uint8_t DecodeR8Texel(const uint8_t* texel)
+        {
+            return texel[0];
+        }
+
+        uint8_t DecodeRgba8Texel(const uint8_t* texel)
+        {
+            return LuminanceFromRgb(texel[0], texel[1], texel[2]);
+        }
+
+        uint8_t DecodeBgra8Texel(const uint8_t* texel)
+        {
+            return LuminanceFromRgb(texel[2], texel[1], texel[0]);
+        }
+
+        //! Decoder of block-compressed formats with blocks of 4x4 texels.
+        template<size_t BlockSize, void (*DecodeBlock)(const uint8_t*, BlockTexels&)>
+        class BlockLuminanceDecoder final : public LuminanceDecoder
+        {
+        public:
+            BlockLuminanceDecoder()
+                : LuminanceDecoder(BlockDim, BlockSize)
+            {
+            }
+
+        protected:
+            void DecodeBlockRow(const uint8_t* blocks, size_t width, size_t rowCount, uint8_t* texels) const override
+            {
+                BlockTexels blockTexels;
+                for (size_t x0 = 0U; x0 < width; x0 += BlockDim, blocks += BlockSize)
+                {
+                    DecodeBlock(blocks, blockTexels);
+
+                    // Whole rows of the block are written at once, unless the block exceeds the image bounds.
+                    const size_t columnCount = AZStd::min(BlockDim, width - x0);
+                    for (size_t y = 0U; y < rowCount; ++y)
+                    {
+                        memcpy(texels + y * width + x0, blockTexels.data() + y * BlockDim, columnCount);
+                    }
+                }
+            }
+        };
+
+        //! Decoder of uncompressed formats, whose blocks are single texels.
+        template<size_t TexelSize, uint8_t (*DecodeTexel)(const uint8_t*)>
+        class TexelLuminanceDecoder final : public LuminanceDecoder
+        {
+        public:
+            TexelLuminanceDecoder()
+                : LuminanceDecoder(1U, TexelSize)
+            {
+            }
+
+        protected:
+            void DecodeBlockRow(const uint8_t* blocks, size_t width, [[maybe_unused]] size_t rowCount, uint8_t* texels) const override
+            {
+                for (size_t x = 0U; x < width; ++x)
+                {
+                    texels[x] = DecodeTexel(blocks + x * TexelSize);
+                }
+            }
+        };
+    } // namespace
+
+    const LuminanceDecoder* LuminanceDecoder::Find(AZ::RHI::Format format)
+    {
+        static const BlockLuminanceDecoder<8U, DecodeBc1Block> Bc1Decoder;
+        static const BlockLuminanceDecoder<16U, DecodeBc3Block> Bc3Decoder;
+        static const BlockLuminanceDecoder<8U, DecodeBc4Block> Bc4Decoder;
+        static const BlockLuminanceDecoder<16U, DecodeBc7Block> Bc7Decoder;
+        static const TexelLuminanceDecoder<1U, DecodeR8Texel> R8Decoder;
+        static const TexelLuminanceDecoder<4U, DecodeRgba8Texel> Rgba8Decoder;
+        static const TexelLuminanceDecoder<4U, DecodeBgra8Texel> Bgra8Decoder;
+
+        // The luminance of sRGB formats is calculated from the encoded values, as done for material colors.
+        using Format = AZ::RHI::Format;
+        switch (format)
+        {
+        case Format::BC1_UNORM:
+        case Format::BC1_UNORM_SRGB:
+            return &Bc1Decoder;
+        case Format::BC3_UNORM:
+        case Format::BC3_UNORM_SRGB:
+            return &Bc3Decoder;
+        case Format::BC4_UNORM:
+            return &Bc4Decoder;
+        case Format::BC7_UNORM:
+        case Format::BC7_UNORM_SRGB:
+            return &Bc7Decoder;
+        case Format::R8_UNORM:
+            return &R8Decoder;
+        case Format::R8G8B8A8_UNORM:
+        case Format::R8G8B8A8_UNORM_SRGB:
+            return &Rgba8Decoder;
+        case Format::B8G8R8A8_UNORM:
+        case Format::B8G8R8A8_UNORM_SRGB:
+            return &Bgra8Decoder;
+        default:
+            return nullptr;
+        }
+    }
+
+    LuminanceDecoder::LuminanceDecoder(size_t blockDim, size_t blockSize)
+        : m_blockDim{ blockDim }
+        , m_blockSize{ blockSize }
+    {
+    }
+
+    size_t LuminanceDecoder::GetImageSize(size_t width, size_t height) const
+    {
+        return ((width + m_blockDim - 1U) / m_blockDim) * ((height + m_blockDim - 1U) / m_blockDim) * m_blockSize;
+    }
+
+    void LuminanceDecoder::Decode(AZStd::span<const uint8_t> data, size_t width, size_t height, uint8_t* texels) const
+    {
+        AZ_Assert(data.size() >= GetImageSize(width, height), "Image data is smaller than the image dimensions.");
+        const size_t blockRowSize = ((width + m_blockDim - 1U) / m_blockDim) * m_blockSize;
+        const size_t blockRowCount = (height + m_blockDim - 1U) / m_blockDim;
+        ParallelFor(
+            blockRowCount,
+            AZStd::max(size_t{ 1U }, MinTexelRowsPerJob / m_blockDim),
+            [&](size_t beginBlockRow, size_t endBlockRow)
+            {
+                for (size_t blockRow = beginBlockRow; blockRow < endBlockRow; ++blockRow)
+                {
+                    const size_t y0 = blockRow * m_blockDim;
+                    DecodeBlockRow(
+                        data.data() + blockRow * blockRowSize, width, AZStd::min(m_blockDim, height - y0), texels + y0 * width);
+                }
+            });
+    }
+
+    void DownsampleLuminance(AZStd::vector<uint8_t>& texels, size_t& width, size_t& height, size_t maxTexelCount)
+    {
+        while (width * height > maxTexelCount && (width > 1U || height > 1U))
+        {
+            const size_t halfWidth = AZStd::max(size_t{ 1U }, width / 2U);
+            const size_t halfHeight = AZStd::max(size_t{ 1U }, height / 2U);
+            // Odd texels at the image borders are skipped, as done when generating mips.
+            const size_t nextX = width > 1U ? 1U : 0U;
+            const size_t nextY = height > 1U ? width : 0U;
+
+            // Each destination texel precedes its source texels, so the texels can be overwritten in place.
+            for (size_t y = 0U; y < halfHeight; ++y)
+            {
+                const uint8_t* srcRow = texels.data() + (y * (height > 1U ? 2U : 1U)) * width;
+                uint8_t* dstRow = texels.data() + y * halfWidth;
+                for (size_t x = 0U; x < halfWidth; ++x)
+                {
+                    const uint8_t* src = srcRow + x * (width > 1U ? 2U : 1U);
+                    const uint32_t sum = src[0] + src[nextX] + src[nextY] + src[nextY + nextX];
+                    dstRow[x] = static_cast<uint8_t>((sum + 2U) / 4U);
+                }
+            }
+
+            width = halfWidth;
+            height = halfHeight;
+        }
+
+        texels.resize(width * height);
+    }
+
+    bool CollapseUniformLuminance(AZStd::vector<uint8_t>& texels, size_t& width, size_t& height, uint8_t tolerance)
+    {
+        if (texels.size() <= 1U)
+        {
+            return false;
+        }
+
+        uint8_t minValue = texels.front();
+        uint8_t maxValue = texels.front();
+        uint64_t sum = 0U;
+        for (const uint8_t value : texels)
+        {
+            minValue = AZStd::min(minValue, value);
+            maxValue = AZStd::max(maxValue, value);
+            if (maxValue - minValue > tolerance)
+            {
+                return false;
+            }
+
+            sum += value;
+        }
+
+        const auto mean = static_cast<uint8_t>((sum + texels.size() / 2U) / texels.size());
+        texels.assign(1U, mean);
+        width = 1U;
+        height = 1U;
+        return true;
+    }
+} // namespace RGL::Utils
@@ -0,0 +1,69 @@
+/* Copyright 2024, Robotec.ai sp. z o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <Atom/RHI.Reflect/Format.h>
+#include <AzCore/base.h>
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace RGL::Utils
+{
+    //! Decodes images of a single format into 8-bit luminance texels, without building an intermediate RGBA image.
+    //! Images are split into blocks of texels (single texels for uncompressed formats), whose rows are decoded in parallel.
+    class LuminanceDecoder
+    {
+    public:
+        //! Returns the decoder of the provided format or nullptr if the format is not supported.
+        static const LuminanceDecoder* Find(AZ::RHI::Format format);
+
+        virtual ~LuminanceDecoder() = default;
+
+        //! Returns the number of bytes occupied by an image of the decoder's format.
+        [[nodiscard]] size_t GetImageSize(size_t width, size_t height) const;
+
+        //! Decodes an image into luminance texels.
+        //! @param data Blocks of the image stored row by row. Has to contain at least GetImageSize bytes.
+        //! @param width Width of the image. Does not have to be a multiple of the block width.
+        //! @param height Height of the image. Does not have to be a multiple of the block height.
+        //! @param texels Destination buffer of width * height texels.
+        void Decode(AZStd::span<const uint8_t> data, size_t width, size_t height, uint8_t* texels) const;
+
+    protected:
+        //! @param blockDim Width (and height) of a block in texels.
+        //! @param blockSize Number of bytes occupied by a single block.
+        LuminanceDecoder(size_t blockDim, size_t blockSize);
+
+        //! Decodes a single row of blocks.
+        //! @param blocks First block of the row.
+        //! @param width Width of the image.
+        //! @param rowCount Number of texel rows covered by the block row. Lower than the block height at the bottom of some images.
+        //! @param texels First texel of the row. Consecutive texel rows are spaced by the image width.
+        virtual void DecodeBlockRow(const uint8_t* blocks, size_t width, size_t rowCount, uint8_t* texels) const = 0;
+
+    private:
+        size_t m_blockDim;
+        size_t m_blockSize;
+    };
+
+    //! Halves the resolution of luminance texels using a box filter until the texel count does not exceed the provided limit.
+    //! The texels are downsampled in place.
+    void DownsampleLuminance(AZStd::vector<uint8_t>& texels, size_t& width, size_t& height, size_t maxTexelCount);
+
+    //! Replaces near-uniform luminance texels with a single texel of their mean value.
+    //! @param tolerance Maximal difference between the texel values of a near-uniform image.
+    //! @return True if the texels were collapsed.
+    bool CollapseUniformLuminance(AZStd::vector<uint8_t>& texels, size_t& width, size_t& height, uint8_t tolerance);
+} // namespace RGL::Utils
@@ -12,29 +12,47 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include <AzCore/std/containers/vector.h>
 #include <Utilities/RGLUtils.h>
+#include <Utilities/RglExecutor.h>
 #include <Wrappers/RglEntity.h>
 #include <Wrappers/RglMesh.h>
 #include <Wrappers/RglTexture.h>
 
 namespace RGL::Wrappers
 {
-    RglEntity::RglEntity(const RglMesh& mesh)
+    namespace
     {
-        bool success = false;
-        Utils::ErrorCheck(rgl_entity_create(&m_nativePtr, nullptr, mesh.m_nativePtr), __FILE__, __LINE__, &success);
-        if (!success && m_nativePtr)
+        void DestroyEntity(rgl_entity_t entity)
         {
-            RGL_CHECK(rgl_entity_destroy(m_nativePtr));
-            m_nativePtr = nullptr;
+            Utils::PostRglCommand(
+                [entity]()
+                {
+                    RGL_CHECK(rgl_entity_destroy(entity));
+                });
         }
+    } // namespace
+
+    RglEntity::RglEntity(const RglMesh& mesh)
+    {
+        Utils::ExecuteRglCommand(
+            [this, &mesh]()
+            {
+                bool success = false;
+                Utils::ErrorCheck(rgl_entity_create(&m_nativePtr, nullptr, mesh.m_nativePtr), __FILE__, __LINE__, &success);
+                if (!success && m_nativePtr)
+                {
+                    RGL_CHECK(rgl_entity_destroy(m_nativePtr));
+                    m_nativePtr = nullptr;
+                }
+            });
     }
 
     RglEntity::RglEntity(RglEntity&& other)
     {
         if (IsValid())
         {
-            RGL_CHECK(rgl_entity_destroy(m_nativePtr));
+            DestroyEntity(m_nativePtr);
         }
 
         m_nativePtr = other.m_nativePtr;
@@ -45,32 +63,52 @@ namespace RGL::Wrappers
     {
         if (IsValid())
         {
-            RGL_CHECK(rgl_entity_destroy(m_nativePtr));
+            DestroyEntity(m_nativePtr);
         }
     }
 
     void RglEntity::SetTransform(const rgl_mat3x4f& pose)
     {
         AZ_Assert(IsValid(), "Tried to set pose of an invalid entity.");
-        RGL_CHECK(rgl_entity_set_transform(m_nativePtr, &pose));
+        Utils::PostRglCommand(
+            [nativePtr = m_nativePtr, pose]()
+            {
+                RGL_CHECK(rgl_entity_set_transform(nativePtr, &pose));
+            });
     }
 
     void RglEntity::SetId(int32_t id)
     {
         AZ_Assert(IsValid(), "Tried to set id of an invalid entity.");
-        RGL_CHECK(rgl_entity_set_id(m_nativePtr, id));
+        Utils::PostRglCommand(
+            [nativePtr = m_nativePtr, id]()
+            {
+                RGL_CHECK(rgl_entity_set_id(nativePtr, id));
+            });
     }
 
     void RglEntity::SetIntensityTexture(const RglTexture& texture)
     {
         AZ_Assert(IsValid(), "Tried to set intensity texture of an invalid entity.");
-        RGL_CHECK(rgl_entity_set_intensity_texture(m_nativePtr, texture.m_nativePtr));
+        // The texture is destroyed through the same queue, so it is still alive once the command is executed.
+        Utils::PostRglCommand(
+            [nativePtr = m_nativePtr, textureNativePtr = texture.m_nativePtr]()
+            {
+                RGL_CHECK(rgl_entity_set_intensity_texture(nativePtr, textureNativePtr));
+            });
     }
 
-    void RglEntity::ApplyExternalAnimation(const rgl_vec3f* vertices, size_t vertexCount)
+    void RglEntity::ApplyExternalAnimation(Utils::RglBufferPool<rgl_vec3f>::BufferPtr vertices, size_t firstVertex, size_t vertexCount)
     {
-        AZ_Assert(IsValid(), "Tried to set intensity texture of an invalid entity.");
-        RGL_CHECK(rgl_entity_apply_external_animation(m_nativePtr, vertices, aznumeric_cast<int32_t>(vertexCount)));
+        AZ_Assert(IsValid(), "Tried to apply external animation to an invalid entity.");
+        AZ_Assert(firstVertex + vertexCount <= vertices->size(), "Tried to apply vertices outside of the buffer.");
+        // The buffer returns to its pool once the command is executed and destroyed, so the caller does not have to wait.
+        Utils::PostRglCommand(
+            [nativePtr = m_nativePtr, vertices = AZStd::move(vertices), firstVertex, vertexCount]()
+            {
+                RGL_CHECK(rgl_entity_apply_external_animation(
+                    nativePtr, vertices->data() + firstVertex, aznumeric_cast<int32_t>(vertexCount)));
+            });
     }
 
     RglEntity& RglEntity::operator=(RglEntity&& other)
@@ -79,7 +117,7 @@ namespace RGL::Wrappers
         {
             if (IsValid())
             {
-                RGL_CHECK(rgl_entity_destroy(m_nativePtr));
+                DestroyEntity(m_nativePtr);
             }
 
             m_nativePtr = other.m_nativePtr;
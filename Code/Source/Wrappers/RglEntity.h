@@ -14,6 +14,7 @@
  */
 #pragma once
 
+#include <Utilities/RglBufferPool.h>
 #include <rgl/api/core.h>
 
 namespace RGL::Wrappers
@@ -42,7 +43,9 @@ namespace RGL::Wrappers
         void SetTransform(const rgl_mat3x4f& pose);
         void SetId(int32_t id);
         void SetIntensityTexture(const RglTexture& texture);
-        void ApplyExternalAnimation(const rgl_vec3f* vertices, size_t vertexCount);
+        //! Applies vertexCount vertices of the buffer, starting at firstVertex.
+        //! The command keeps a reference to the buffer instead of copying it, so the buffer must not be modified afterwards.
+        void ApplyExternalAnimation(Utils::RglBufferPool<rgl_vec3f>::BufferPtr vertices, size_t firstVertex, size_t vertexCount);
 
         RglEntity& operator=(const RglEntity& other) = delete;
         RglEntity& operator=(RglEntity&& other);
@@ -13,52 +13,108 @@
  * limitations under the License.
  */
 #include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/std/containers/vector.h>
 #include <Utilities/RGLUtils.h>
+#include <Utilities/RglExecutor.h>
 #include <Wrappers/RglMesh.h>
 #include <rgl/api/core.h>
 
 namespace RGL::Wrappers
 {
+    namespace
+    {
+        void DestroyMesh(rgl_mesh_t mesh)
+        {
+            Utils::PostRglCommand(
+                [mesh]()
+                {
+                    RGL_CHECK(rgl_mesh_destroy(mesh));
+                });
+        }
+    } // namespace
+
     RglMesh::RglMesh(const rgl_vec3f* vertices, size_t vertexCount, const rgl_vec3i* indices, size_t indexCount)
     {
-        bool success = false;
-        Utils::ErrorCheck(
-            rgl_mesh_create(&m_nativePtr, vertices, aznumeric_cast<int32_t>(vertexCount), indices, aznumeric_cast<int32_t>(indexCount)),
-            __FILE__,
-            __LINE__,
-            &success);
+        const bool success = Utils::ExecuteRglCommand(
+            [this, vertices, vertexCount, indices, indexCount]()
+            {
+                bool isCreated = false;
+                Utils::ErrorCheck(
+                    rgl_mesh_create(
+                        &m_nativePtr, vertices, aznumeric_cast<int32_t>(vertexCount), indices, aznumeric_cast<int32_t>(indexCount)),
+                    __FILE__,
+                    __LINE__,
+                    &isCreated);
 
-        if (!success && m_nativePtr)
+                if (!isCreated && m_nativePtr)
+                {
+                    RGL_CHECK(rgl_mesh_destroy(m_nativePtr));
+                    m_nativePtr = nullptr;
+                }
+
+                return isCreated;
+            });
+
+        if (!success)
         {
-            RGL_CHECK(rgl_mesh_destroy(m_nativePtr));
-            m_nativePtr = nullptr;
+            return;
         }
+
+        m_vertexCount = vertexCount;
+        m_indexCount = indexCount;
     }
 
     RglMesh::RglMesh(RglMesh&& other)
     {
         if (IsValid())
         {
-            RGL_CHECK(rgl_mesh_destroy(m_nativePtr));
+            DestroyMesh(m_nativePtr);
         }
 
         m_nativePtr = other.m_nativePtr;
+        m_vertexCount = other.m_vertexCount;
+        m_indexCount = other.m_indexCount;
+        m_uvCount = other.m_uvCount;
         other.m_nativePtr = nullptr;
+        other.m_vertexCount = other.m_indexCount = other.m_uvCount = 0U;
     }
 
     RglMesh::~RglMesh()
     {
         if (IsValid())
         {
-            RGL_CHECK(rgl_mesh_destroy(m_nativePtr));
+            DestroyMesh(m_nativePtr);
             m_nativePtr = nullptr;
         }
     }
 
-    void RglMesh::SetTextureCoordinates(const rgl_vec2f* uvs, size_t uvCount)
+    void RglMesh::SetTextureCoordinates(Utils::RglBufferPool<rgl_vec2f>::BufferPtr uvs)
     {
         AZ_Assert(IsValid(), "Tried to set texture coordinates of an invalid mesh.");
-        RGL_CHECK(rgl_mesh_set_texture_coords(m_nativePtr, uvs, aznumeric_cast<int32_t>(uvCount)));
+        // Failures are reported by the command, so the UVs are accounted for in advance.
+        m_uvCount = uvs->size();
+        // The buffer returns to its pool once the command is executed and destroyed, so the caller does not have to wait.
+        Utils::PostRglCommand(
+            [nativePtr = m_nativePtr, uvs = AZStd::move(uvs)]()
+            {
+                RGL_CHECK(rgl_mesh_set_texture_coords(nativePtr, uvs->data(), aznumeric_cast<int32_t>(uvs->size())));
+            });
+    }
+
+    void RglMesh::SetTextureCoordinates(const rgl_vec2f* uvs, size_t uvCount)
+    {
+        Utils::RglBufferPool<rgl_vec2f>::BufferPtr buffer = Utils::RglBufferPool<rgl_vec2f>::Get().Acquire();
+        buffer->assign(uvs, uvs + uvCount);
+        SetTextureCoordinates(AZStd::move(buffer));
+    }
+
+    MemoryUsage RglMesh::GetMemoryUsage() const
+    {
+        MemoryUsage usage;
+        usage.m_vertexBytes = m_vertexCount * sizeof(rgl_vec3f);
+        usage.m_indexBytes = m_indexCount * sizeof(rgl_vec3i);
+        usage.m_uvBytes = m_uvCount * sizeof(rgl_vec2f);
+        return usage;
     }
 
     RglMesh& RglMesh::operator=(RglMesh&& other)
@@ -67,11 +123,15 @@ namespace RGL::Wrappers
         {
             if (IsValid())
             {
-                RGL_CHECK(rgl_mesh_destroy(m_nativePtr));
+                DestroyMesh(m_nativePtr);
             }
 
             m_nativePtr = other.m_nativePtr;
+            m_vertexCount = other.m_vertexCount;
+            m_indexCount = other.m_indexCount;
+            m_uvCount = other.m_uvCount;
             other.m_nativePtr = nullptr;
+            other.m_vertexCount = other.m_indexCount = other.m_uvCount = 0U;
         }
 
         return *this;
@@ -15,6 +15,8 @@
 #pragma once
 
 #include <AzCore/std/containers/vector.h>
+#include <RGL/MemoryUsageBus.h>
+#include <Utilities/RglBufferPool.h>
 #include <rgl/api/core.h>
 
 namespace RGL::Wrappers
@@ -41,8 +43,14 @@ namespace RGL::Wrappers
             return m_nativePtr;
         }
 
+        //! The command keeps a reference to the buffer instead of copying it, so the buffer must not be modified afterwards.
+        void SetTextureCoordinates(Utils::RglBufferPool<rgl_vec2f>::BufferPtr uvs);
+        //! Copies the UVs into a pooled buffer, so that the caller's buffer can be reused right after the call.
         void SetTextureCoordinates(const rgl_vec2f* uvs, size_t uvCount);
 
+        //! Returns the number of bytes of vertex, index and UV data uploaded with this mesh.
+        [[nodiscard]] MemoryUsage GetMemoryUsage() const;
+
         RglMesh& operator=(const RglMesh& other) = delete;
         RglMesh& operator=(RglMesh&& other);
 
@@ -53,5 +61,9 @@ namespace RGL::Wrappers
         RglMesh() = default;
 
         rgl_mesh_t m_nativePtr{ nullptr };
+
+        size_t m_vertexCount{ 0U };
+        size_t m_indexCount{ 0U };
+        size_t m_uvCount{ 0U };
     };
 } // namespace RGL::Wrappers
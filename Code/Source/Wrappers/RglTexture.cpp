@@ -12,70 +12,81 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
-#include <Atom/RPI.Public/BlockCompression.h>
 #include <AzCore/Name/NameDictionary.h>
 #include <Utilities/RGLUtils.h>
+#include <Utilities/RglExecutor.h>
+#include <Utilities/TextureDecoding.h>
 #include <Wrappers/RglTexture.h>
 
 namespace RGL::Wrappers
 {
-    RglTexture RglTexture::CreateFromMaterialAsset(const AZ::Data::Asset<AZ::RPI::MaterialAsset>& materialAsset)
+    namespace
     {
-        static const AZStd::string TraceWindowName = ConstructTraceWindowName(__func__);
-        static const AZ::Name albedoTexName = AZ::Name::FromStringLiteral("baseColor.textureMap", AZ::Interface<AZ::NameDictionary>::Get());
-        static const AZ::Name albedoColorName = AZ::Name::FromStringLiteral("baseColor.color", AZ::Interface<AZ::NameDictionary>::Get());
-
-        RglTexture imageRglTexture = CreateInvalid();
-
-        [[maybe_unused]] const AZ::Data::AssetId& id = materialAsset.GetId();
-        if (!materialAsset.IsReady())
+        void DestroyTexture(rgl_texture_t texture)
         {
-            AZ_Warning(
-                TraceWindowName.c_str(), false, "The material asset with ID: %s was not ready.", id.ToString<AZStd::string>().c_str());
-            return imageRglTexture;
+            Utils::PostRglCommand(
+                [texture]()
+                {
+                    RGL_CHECK(rgl_texture_destroy(texture));
+                });
         }
+    } // namespace
 
-        const auto* propLayout = materialAsset->GetMaterialPropertiesLayout();
-
-        if (!propLayout)
+    RglTexture RglTexture::CreateFromMaterialAsset(const AZ::Data::Asset<AZ::RPI::MaterialAsset>& materialAsset)
+    {
+        if (const AZ::Data::AssetId imageAssetId = FindBaseColorImageAssetId(materialAsset); imageAssetId.IsValid())
         {
-            AZ_Warning(
-                TraceWindowName.c_str(),
-                false,
-                "Unable to access material properties layout of material asset with ID: %s.",
-                id.ToString<AZStd::string>().c_str());
-            return imageRglTexture;
+            if (RglTexture imageRglTexture = CreateFromImageAsset(imageAssetId); imageRglTexture.IsValid())
+            {
+                return imageRglTexture;
+            }
         }
 
-        auto& propertyValues = materialAsset->GetPropertyValues();
+        RglTexture colorRglTexture = CreateFromMaterialColor(materialAsset);
+        AZ_Error(
+            ConstructTraceWindowName(__func__).c_str(),
+            colorRglTexture.IsValid(),
+            "Unable to find specular color and texture properties of material asset with ID: %s.",
+            materialAsset.GetId().ToString<AZStd::string>().c_str());
+        return colorRglTexture;
+    }
 
-        if (const auto albedoTexPropIdx = propLayout->FindPropertyIndex(albedoTexName); !albedoTexPropIdx.IsNull())
+    RglTexture RglTexture::CreateFromMaterialColor(const AZ::Data::Asset<AZ::RPI::MaterialAsset>& materialAsset)
+    {
+        static const AZ::Name albedoColorName = AZ::Name::FromStringLiteral("baseColor.color", AZ::Interface<AZ::NameDictionary>::Get());
+
+        const auto* propLayout = GetMaterialPropertiesLayout(materialAsset);
+        if (!propLayout)
         {
-            const auto albedoTexImagePropVal = propertyValues.at(albedoTexPropIdx.GetIndex());
-            const auto& imageAsset = albedoTexImagePropVal.GetValue<AZ::Data::Asset<AZ::RPI::ImageAsset>>();
-            imageRglTexture = CreateFromImageAsset(imageAsset.GetId());
+            return CreateInvalid();
         }
 
-        if (imageRglTexture.IsValid())
+        if (const auto albedoColorPropIdx = propLayout->FindPropertyIndex(albedoColorName); !albedoColorPropIdx.IsNull())
         {
-            return imageRglTexture;
+            const auto& propertyValues = materialAsset->GetPropertyValues();
+            return CreateFromFactor(CreateGrayFromColor(propertyValues.at(albedoColorPropIdx.GetIndex()).GetValue<AZ::Color>()));
         }
 
-        if (const auto albedoColorPropIdx = propLayout->FindPropertyIndex(albedoColorName); !albedoColorPropIdx.IsNull())
+        return CreateInvalid();
+    }
+
+    AZ::Data::AssetId RglTexture::FindBaseColorImageAssetId(const AZ::Data::Asset<AZ::RPI::MaterialAsset>& materialAsset)
+    {
+        static const AZ::Name albedoTexName = AZ::Name::FromStringLiteral("baseColor.textureMap", AZ::Interface<AZ::NameDictionary>::Get());
+
+        const auto* propLayout = GetMaterialPropertiesLayout(materialAsset);
+        if (!propLayout)
         {
-            imageRglTexture =
-                AZStd::move(CreateFromFactor(CreateGrayFromColor(propertyValues.at(albedoColorPropIdx.GetIndex()).GetValue<AZ::Color>())));
+            return {};
         }
-        else
+
+        if (const auto albedoTexPropIdx = propLayout->FindPropertyIndex(albedoTexName); !albedoTexPropIdx.IsNull())
         {
-            AZ_Error(
-                TraceWindowName.c_str(),
-                false,
-                "Unable to find specular color and texture properties of material asset with ID: %s.",
-                id.ToString<AZStd::string>().c_str());
+            const auto albedoTexImagePropVal = materialAsset->GetPropertyValues().at(albedoTexPropIdx.GetIndex());
+            return albedoTexImagePropVal.GetValue<AZ::Data::Asset<AZ::RPI::ImageAsset>>().GetId();
         }
 
-        return imageRglTexture;
+        return {};
     }
 
     RglTexture RglTexture::CreateFromFactor(float factor)
@@ -84,26 +95,38 @@ namespace RGL::Wrappers
         return RglTexture{ &factor8, 1, 1 };
     }
 
-    float RglTexture::CreateGrayFromColor(const AZ::Color& color)
+    const AZ::RPI::MaterialPropertiesLayout* RglTexture::GetMaterialPropertiesLayout(
+        const AZ::Data::Asset<AZ::RPI::MaterialAsset>& materialAsset)
     {
-        return RedGrayMultiplier * color.GetR() + GreenGrayMultiplier * color.GetG() + BlueGrayMultiplier * color.GetB();
+        static const AZStd::string TraceWindowName = ConstructTraceWindowName(__func__);
+
+        [[maybe_unused]] const AZ::Data::AssetId& id = materialAsset.GetId();
+        if (!materialAsset.IsReady())
+        {
+            AZ_Warning(
+                TraceWindowName.c_str(), false, "The material asset with ID: %s was not ready.", id.ToString<AZStd::string>().c_str());
+            return nullptr;
+        }
+
+        const auto* propLayout = materialAsset->GetMaterialPropertiesLayout();
+        AZ_Warning(
+            TraceWindowName.c_str(),
+            propLayout,
+            "Unable to access material properties layout of material asset with ID: %s.",
+            id.ToString<AZStd::string>().c_str());
+        return propLayout;
     }
 
-    uint8_t RglTexture::CreateGray8FromColor(const AZ::Color& color)
+    float RglTexture::CreateGrayFromColor(const AZ::Color& color)
     {
-        return static_cast<uint8_t>(CreateGrayFromColor(color) * 255.0f);
+        return RedGrayMultiplier * color.GetR() + GreenGrayMultiplier * color.GetG() + BlueGrayMultiplier * color.GetB();
     }
 
-    RglTexture RglTexture::CreateFromImageAsset(const AZ::Data::AssetId& imageAssetId)
+    RglTexture RglTexture::CreateFromImageAsset(const AZ::Data::AssetId& imageAssetId, size_t maxTexelCount)
     {
-        // Made a static member to minimize reallocations, since multiple assets will be processed.
-        static AZStd::vector<uint8_t> tempRglTextureData;
-
-        RglTexture imageRglTexture = CreateInvalid();
-
         if (!imageAssetId.IsValid())
         {
-            return imageRglTexture;
+            return CreateInvalid();
         }
 
         AZ::Data::Asset<AZ::RPI::StreamingImageAsset> imageAsset =
@@ -114,102 +137,151 @@ namespace RGL::Wrappers
         imageAsset.QueueLoad();
         imageAsset.BlockUntilLoadComplete();
 
+        TexelData texelData;
+        if (!DecodeImageAsset(imageAsset, texelData, maxTexelCount))
+        {
+            return CreateInvalid();
+        }
+
+        return RglTexture{ texelData.m_texels.data(), texelData.m_width, texelData.m_height };
+    }
+
+    bool RglTexture::DecodeImageAsset(
+        const AZ::Data::Asset<AZ::RPI::StreamingImageAsset>& imageAsset, TexelData& texelData, size_t maxTexelCount)
+    {
+        if (!imageAsset.IsReady())
+        {
+            AZ_Warning(
+                ConstructTraceWindowName(__func__).c_str(),
+                false,
+                "The image asset with ID: %s was not ready.",
+                imageAsset.GetId().ToString<AZStd::string>().c_str());
+            return false;
+        }
+
         const AZ::RHI::ImageDescriptor imageDescriptor = imageAsset->GetImageDescriptor();
 
-        using Format = AZ::RHI::Format;
-        const auto format = imageDescriptor.m_format;
         const auto& size = imageDescriptor.m_size;
-        if (format == Format::BC1_UNORM || format == Format::BC1_UNORM_SRGB || format == Format::BC4_UNORM)
+        const Utils::LuminanceDecoder* decoder = Utils::LuminanceDecoder::Find(imageDescriptor.m_format);
+        if (!decoder)
         {
-            tempRglTextureData.resize(size.m_width * size.m_height);
-
-            // Only highest detail mip.
-            AZStd::span<const uint8_t> imageData = imageAsset->GetSubImageData(0, 0);
-            size_t srcIdx = 0, sliceIdx = 0;
-            for (size_t y = 0; y < size.m_height; y += 4)
-            {
-                for (size_t x = 0; x < size.m_width; x += 4)
-                {
-                    if (format == Format::BC4_UNORM)
-                    {
-                        LoadBlockToGrays(
-                            reinterpret_cast<const AZ::RPI::BC4Block*>(imageData.data() + srcIdx), tempRglTextureData, x, y, size.m_width);
-                    }
-                    else
-                    {
-                        LoadBlockToGrays(
-                            reinterpret_cast<const AZ::RPI::BC1Block*>(imageData.data() + srcIdx), tempRglTextureData, x, y, size.m_width);
-                    }
-
-                    srcIdx += 8;
-                    if (srcIdx == imageData.size() && ++sliceIdx < imageDescriptor.m_arraySize)
-                    {
-                        imageData = imageAsset->GetSubImageData(0, sliceIdx);
-                        srcIdx = 0;
-                    }
-                }
-            }
+            AZ_Warning(
+                ConstructTraceWindowName(__func__).c_str(),
+                false,
+                "Image is of unsupported type: %s. Only BC1, BC3, BC4, BC7, R8, R8G8B8A8 and B8G8R8A8 formats are currently supported. "
+                "Skipping...",
+                ToString(imageDescriptor.m_format));
+            return false;
+        }
 
-            imageRglTexture = RglTexture{ tempRglTextureData.data(), size.m_width, size.m_height };
+        // The highest detail mip not exceeding the texel count limit is decoded.
+        AZ::u32 mipLevel = 0U;
+        size_t width = size.m_width;
+        size_t height = size.m_height;
+        while (maxTexelCount > 0U && width * height > maxTexelCount && mipLevel + 1U < imageDescriptor.m_mipLevels)
+        {
+            ++mipLevel;
+            width = AZStd::max(size_t{ 1U }, width / 2U);
+            height = AZStd::max(size_t{ 1U }, height / 2U);
         }
-        else
+
+        const AZStd::span<const uint8_t> imageData = imageAsset->GetSubImageData(mipLevel, 0);
+        if (imageData.size() < decoder->GetImageSize(width, height))
         {
             AZ_Warning(
                 ConstructTraceWindowName(__func__).c_str(),
                 false,
-                "Image is of unsupported type: %s. Only BC1 and BC4 formats are currently supported. Skipping...",
-                ToString(imageDescriptor.m_format));
+                "Data of mip %u of the image asset with ID: %s is smaller than expected. Skipping...",
+                mipLevel,
+                imageAsset.GetId().ToString<AZStd::string>().c_str());
+            return false;
+        }
+
+        texelData.m_texels.resize(width * height);
+        texelData.m_width = width;
+        texelData.m_height = height;
+        decoder->Decode(imageData, width, height, texelData.m_texels.data());
+
+        // Images without a sufficient mip chain are downsampled after decoding.
+        if (maxTexelCount > 0U)
+        {
+            Utils::DownsampleLuminance(texelData.m_texels, texelData.m_width, texelData.m_height, maxTexelCount);
         }
 
-        return imageRglTexture;
+        return true;
     }
 
     RglTexture::RglTexture(const uint8_t* texels, size_t width, size_t height)
     {
-        bool success = false;
-        Utils::ErrorCheck(
-            rgl_texture_create(&m_nativePtr, texels, aznumeric_cast<int32_t>(width), aznumeric_cast<int32_t>(height)),
-            __FILE__,
-            __LINE__,
-            &success);
+        const bool success = Utils::ExecuteRglCommand(
+            [this, texels, width, height]()
+            {
+                bool isCreated = false;
+                Utils::ErrorCheck(
+                    rgl_texture_create(&m_nativePtr, texels, aznumeric_cast<int32_t>(width), aznumeric_cast<int32_t>(height)),
+                    __FILE__,
+                    __LINE__,
+                    &isCreated);
+
+                if (!isCreated && m_nativePtr)
+                {
+                    RGL_CHECK(rgl_texture_destroy(m_nativePtr));
+                    m_nativePtr = nullptr;
+                }
 
-        if (!success && m_nativePtr)
+                return isCreated;
+            });
+
+        if (!success)
         {
-            RGL_CHECK(rgl_texture_destroy(m_nativePtr));
-            m_nativePtr = nullptr;
+            return;
         }
+
+        m_texelCount = width * height;
     }
 
     RglTexture::RglTexture(RglTexture&& other)
     {
         if (IsValid())
         {
-            RGL_CHECK(rgl_texture_destroy(m_nativePtr));
+            DestroyTexture(m_nativePtr);
         }
 
         m_nativePtr = other.m_nativePtr;
+        m_texelCount = other.m_texelCount;
         other.m_nativePtr = nullptr;
+        other.m_texelCount = 0U;
     }
 
     RglTexture::~RglTexture()
     {
         if (IsValid())
         {
-            RGL_CHECK(rgl_texture_destroy(m_nativePtr));
+            DestroyTexture(m_nativePtr);
         }
     }
 
+    MemoryUsage RglTexture::GetMemoryUsage() const
+    {
+        MemoryUsage usage;
+        // Intensity textures store a single byte per texel.
+        usage.m_textureBytes = m_texelCount * sizeof(uint8_t);
+        return usage;
+    }
+
     RglTexture& RglTexture::operator=(RglTexture&& other)
     {
         if (this != &other)
         {
             if (IsValid())
             {
-                RGL_CHECK(rgl_texture_destroy(m_nativePtr));
+                DestroyTexture(m_nativePtr);
             }
 
             m_nativePtr = other.m_nativePtr;
+            m_texelCount = other.m_texelCount;
             other.m_nativePtr = nullptr;
+            other.m_texelCount = 0U;
         }
 
         return *this;
@@ -15,8 +15,10 @@
 #pragma once
 
 #include <Atom/RPI.Reflect/Image/ImageAsset.h>
+#include <Atom/RPI.Reflect/Image/StreamingImageAsset.h>
 #include <Atom/RPI.Reflect/Material/MaterialAsset.h>
 #include <AzCore/Asset/AssetCommon.h>
+#include <RGL/MemoryUsageBus.h>
 #include <rgl/api/core.h>
 
 namespace RGL::Wrappers
@@ -28,16 +30,39 @@ namespace RGL::Wrappers
         friend class RglEntity;
 
     public:
+        //! Intensity texels decoded from an image, ready to be uploaded to RGL.
+        struct TexelData
+        {
+            AZStd::vector<uint8_t> m_texels;
+            size_t m_width{ 0U };
+            size_t m_height{ 0U };
+        };
+
         static RglTexture CreateInvalid()
         {
             return {};
         }
 
-        //! This function is not thread safe.
+        //! Blocks until the base color image of the material is loaded.
+        //! @see FindBaseColorImageAssetId and CreateFromMaterialColor for the non-blocking alternative.
         static RglTexture CreateFromMaterialAsset(const AZ::Data::Asset<AZ::RPI::MaterialAsset>& materialAsset);
         static RglTexture CreateFromFactor(float factor);
-        //! This function is not thread safe. Currently, only images in the BC1 format are supported.
-        static RglTexture CreateFromImageAsset(const AZ::Data::AssetId& imageAssetId);
+        //! Creates a single-texel texture using the base color factor of the material.
+        //! Returns an invalid texture if the material provides no base color factor.
+        static RglTexture CreateFromMaterialColor(const AZ::Data::Asset<AZ::RPI::MaterialAsset>& materialAsset);
+        //! Blocks until the image asset is loaded. Supported formats are listed in Utils::LuminanceDecoder::Find.
+        //! @see DecodeImageAsset
+        static RglTexture CreateFromImageAsset(const AZ::Data::AssetId& imageAssetId, size_t maxTexelCount = 0U);
+
+        //! Returns the ID of the base color image of the material. The returned ID is invalid if the material does not use one.
+        static AZ::Data::AssetId FindBaseColorImageAssetId(const AZ::Data::Asset<AZ::RPI::MaterialAsset>& materialAsset);
+        //! Decodes a loaded image into intensity texels.
+        //! This function is thread safe, as long as the texel data is not shared between threads.
+        //! @param maxTexelCount Maximal number of texels of the decoded texture (0 for no limit). The highest detail mip
+        //! not exceeding the limit is decoded. If there is no such mip, the decoded texels are downsampled.
+        //! @return False if the image format is not supported.
+        static bool DecodeImageAsset(
+            const AZ::Data::Asset<AZ::RPI::StreamingImageAsset>& imageAsset, TexelData& texelData, size_t maxTexelCount = 0U);
 
         RglTexture(const uint8_t* texels, size_t width, size_t height);
         RglTexture(const RglTexture& other) = delete;
@@ -49,6 +74,9 @@ namespace RGL::Wrappers
             return m_nativePtr;
         }
 
+        //! Returns the number of bytes of texel data uploaded with this texture.
+        [[nodiscard]] MemoryUsage GetMemoryUsage() const;
+
         RglTexture& operator=(const RglTexture& other) = delete;
         RglTexture& operator=(RglTexture&& other);
 
@@ -63,22 +91,11 @@ namespace RGL::Wrappers
             return AZStd::string("RGL::RglTexture::") + functionName;
         }
 
-        static float CreateGrayFromColor(const AZ::Color& color);
-        static uint8_t CreateGray8FromColor(const AZ::Color& color);
+        //! Returns nullptr (and reports a warning) if the material asset is not ready or provides no properties layout.
+        static const AZ::RPI::MaterialPropertiesLayout* GetMaterialPropertiesLayout(
+            const AZ::Data::Asset<AZ::RPI::MaterialAsset>& materialAsset);
 
-        template<typename BlockT>
-        static void LoadBlockToGrays(const BlockT* block, AZStd::vector<uint8_t>& grayValues, size_t blockX, size_t blockY, size_t width)
-        {
-            size_t i = 0;
-            for (size_t y = blockY; y < blockY + 4; ++y)
-            {
-                for (size_t x = blockX; x < blockX + 4; ++x)
-                {
-                    grayValues[x + y * width] = CreateGray8FromColor(block->GetBlockColor(i));
-                    ++i;
-                }
-            }
-        }
+        static float CreateGrayFromColor(const AZ::Color& color);
 
         // Weights used to convert RGB to Grayscale using the luminosity
         // method as opposed to taking an average.
@@ -87,5 +104,6 @@ namespace RGL::Wrappers
         static constexpr float BlueGrayMultiplier = 0.114f;
 
         rgl_texture_t m_nativePtr{ nullptr };
+        size_t m_texelCount{ 0U };
     };
 } // namespace RGL::Wrappers
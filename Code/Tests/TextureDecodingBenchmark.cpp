@@ -0,0 +1,63 @@
+/* Copyright 2024, Robotec.ai sp. z o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#if defined(HAVE_BENCHMARK)
+
+#include <AzCore/Math/Random.h>
+#include <AzCore/std/containers/vector.h>
+#include <Utilities/TextureDecoding.h>
+#include <benchmark/benchmark.h>
+
+namespace Benchmark
+{
+    namespace
+    {
+        constexpr size_t ImageDim = 1024U;
+
+        //! Decodes an image of random blocks. Every bit pattern is a valid block in the benchmarked formats.
+        void BM_LuminanceDecoder(benchmark::State& state, AZ::RHI::Format format)
+        {
+            const RGL::Utils::LuminanceDecoder* decoder = RGL::Utils::LuminanceDecoder::Find(format);
+            AZ_Assert(decoder, "Benchmarked format is not supported.");
+
+            AZStd::vector<uint8_t> data(decoder->GetImageSize(ImageDim, ImageDim));
+            AZ::SimpleLcgRandom random(1234U);
+            for (uint8_t& byte : data)
+            {
+                byte = static_cast<uint8_t>(random.GetRandom());
+            }
+
+            AZStd::vector<uint8_t> texels(ImageDim * ImageDim);
+            for ([[maybe_unused]] auto _ : state)
+            {
+                decoder->Decode(data, ImageDim, ImageDim, texels.data());
+                benchmark::DoNotOptimize(texels.data());
+                benchmark::ClobberMemory();
+            }
+
+            state.SetItemsProcessed(state.iterations() * ImageDim * ImageDim);
+            state.SetBytesProcessed(state.iterations() * data.size());
+        }
+    } // namespace
+
+    BENCHMARK_CAPTURE(BM_LuminanceDecoder, Bc1, AZ::RHI::Format::BC1_UNORM)->Unit(benchmark::kMicrosecond);
+    BENCHMARK_CAPTURE(BM_LuminanceDecoder, Bc3, AZ::RHI::Format::BC3_UNORM)->Unit(benchmark::kMicrosecond);
+    BENCHMARK_CAPTURE(BM_LuminanceDecoder, Bc4, AZ::RHI::Format::BC4_UNORM)->Unit(benchmark::kMicrosecond);
+    BENCHMARK_CAPTURE(BM_LuminanceDecoder, Bc7, AZ::RHI::Format::BC7_UNORM)->Unit(benchmark::kMicrosecond);
+    BENCHMARK_CAPTURE(BM_LuminanceDecoder, R8, AZ::RHI::Format::R8_UNORM)->Unit(benchmark::kMicrosecond);
+    BENCHMARK_CAPTURE(BM_LuminanceDecoder, Rgba8, AZ::RHI::Format::R8G8B8A8_UNORM)->Unit(benchmark::kMicrosecond);
+    BENCHMARK_CAPTURE(BM_LuminanceDecoder, Bgra8, AZ::RHI::Format::B8G8R8A8_UNORM)->Unit(benchmark::kMicrosecond);
+} // namespace Benchmark
+
+#endif // HAVE_BENCHMARK
@@ -0,0 +1,210 @@
+/* Copyright 2024, Robotec.ai sp. z o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <AzCore/std/containers/vector.h>
+#include <AzTest/AzTest.h>
+#include <Utilities/TextureDecoding.h>
+
+namespace UnitTest
+{
+    namespace
+    {
+        constexpr size_t BlockDim = 4U;
+        constexpr size_t BlockTexelCount = BlockDim * BlockDim;
+        //! Maximal difference from the reference luminance.
+        //! The decoders interpolate luminance instead of color channels, which changes the rounding.
+        constexpr int LuminanceTolerance = 1;
+
+        // The expected texels were decoded by an independent BCn decoder and converted to luminance using the same weights
+        // (77, 150 and 29, scaled by 256) as the decoders.
+        // Four color mode, three color mode (with the transparent black index) and random blocks.
+        constexpr uint8_t Bc1Blocks[][8] = {
+            { 0x00, 0xF8, 0x1F, 0x00, 0xE4, 0xE4, 0xE4, 0xE4 },
+            { 0xE0, 0x07, 0xFF, 0xFF, 0x1B, 0x1B, 0x1B, 0x1B },
+            { 0x38, 0xB4, 0xE6, 0x52, 0xE4, 0x4D, 0xA7, 0xF2 },
+            { 0x37, 0x0D, 0x9E, 0x26, 0x0E, 0x27, 0x13, 0x65 },
+            { 0x50, 0xA4, 0xA3, 0xA6, 0xD0, 0x7F, 0x5C, 0x0C },
+            { 0x33, 0x2F, 0x8B, 0x12, 0x24, 0x08, 0x3F, 0xD2 },
+            { 0x2B, 0x90, 0x2F, 0x89, 0x11, 0xE8, 0x18, 0x18 },
+            { 0xF8, 0xC9, 0x9D, 0x5D, 0x5D, 0x98, 0x31, 0x95 },
+        };
+
+        constexpr uint8_t Bc1ExpectedTexels[][BlockTexelCount] = {
+            { 76, 28, 60, 44, 76, 28, 60, 44, 76, 28, 60, 44, 76, 28, 60, 44 },
+            { 0, 202, 255, 149, 0, 202, 255, 149, 0, 202, 255, 149, 0, 202, 255, 149 },
+            { 155, 84, 131, 107, 84, 107, 155, 84, 107, 84, 131, 131, 131, 155, 107, 107 },
+            { 140, 0, 121, 121, 0, 161, 140, 121, 0, 121, 161, 121, 161, 161, 140, 161 },
+            { 145, 145, 178, 0, 0, 0, 0, 178, 145, 0, 178, 178, 145, 0, 145, 145 },
+            { 165, 62, 130, 165, 165, 130, 165, 165, 96, 96, 96, 165, 130, 165, 62, 96 },
+            { 77, 57, 77, 57, 57, 63, 63, 70, 57, 63, 77, 57, 57, 63, 77, 57 },
+            { 158, 144, 158, 158, 119, 132, 158, 132, 158, 119, 144, 119, 158, 158, 158, 132 },
+        };
+
+        // Random blocks. The alpha part of each block does not affect the luminance.
+        constexpr uint8_t Bc3Blocks[][16] = {
+            { 0x75, 0x04, 0xD9, 0x0E, 0x94, 0x5D, 0xE2, 0xE8, 0xF5, 0x4E, 0xE7, 0x81, 0xCC, 0x75, 0xF6, 0x36 },
+            { 0xD8, 0x50, 0x99, 0x09, 0x5A, 0xA3, 0x00, 0x16, 0x5A, 0x67, 0x03, 0x6F, 0x9B, 0x54, 0x0D, 0x6B },
+            { 0x8F, 0x0B, 0xE2, 0x11, 0x24, 0x17, 0x9C, 0x3D, 0xD9, 0xF7, 0x38, 0x17, 0xCE, 0x6E, 0x11, 0x8D },
+            { 0x26, 0x4A, 0xAD, 0x6C, 0xB6, 0xDD, 0x21, 0x0F, 0xAF, 0x94, 0xAC, 0xD3, 0xCF, 0x92, 0xC1, 0x90 },
+            { 0x23, 0x7C, 0xB1, 0x1F, 0x5D, 0x10, 0x8C, 0xF2, 0x59, 0x30, 0x26, 0x39, 0x38, 0xB3, 0x70, 0xA1 },
+            { 0xB5, 0x76, 0x9F, 0xA0, 0xF1, 0x48, 0x3F, 0x95, 0xA9, 0x0D, 0x9D, 0xF2, 0xF1, 0x30, 0xD6, 0x0F },
+            { 0xCF, 0x04, 0xBD, 0x93, 0xF5, 0x0A, 0xE6, 0x95, 0x14, 0xDA, 0x8C, 0x65, 0x9C, 0xE2, 0xB1, 0x0C },
+            { 0xCC, 0xDA, 0xEB, 0xF9, 0x90, 0xD1, 0x98, 0x38, 0xB0, 0xD7, 0xEC, 0x0B, 0x3E, 0x97, 0x81, 0x8E },
+        };
+
+        constexpr uint8_t Bc3ExpectedTexels[][BlockTexelCount] = {
+            { 172, 111, 172, 111, 81, 81, 111, 81, 141, 81, 111, 111, 141, 81, 111, 172 },
+            { 175, 183, 167, 183, 191, 167, 167, 167, 167, 175, 191, 191, 175, 183, 183, 167 },
+            { 217, 189, 244, 189, 217, 189, 217, 162, 162, 244, 162, 244, 162, 189, 244, 217 },
+            { 144, 144, 146, 144, 145, 146, 144, 145, 144, 146, 146, 144, 146, 146, 144, 145 },
+            { 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 43, 43, 42, 42, 42 },
+            { 148, 117, 137, 137, 117, 117, 137, 117, 127, 148, 148, 137, 137, 137, 117, 117 },
+            { 123, 137, 145, 130, 130, 123, 130, 137, 145, 123, 137, 130, 123, 137, 123, 123 },
+            { 178, 132, 132, 224, 132, 86, 86, 178, 86, 224, 224, 178, 178, 132, 224, 178 },
+        };
+
+        // Eight value mode, six value mode (with the extreme values) and random blocks.
+        constexpr uint8_t Bc4Blocks[][8] = {
+            { 0xC8, 0x14, 0xCB, 0x96, 0xC4, 0xDB, 0x17, 0x22 },
+            { 0x14, 0xC8, 0x96, 0xD5, 0x23, 0x4A, 0x4C, 0x6B },
+            { 0xA4, 0xE6, 0xED, 0x24, 0xEC, 0x63, 0x6A, 0x8A },
+            { 0xC0, 0xA1, 0x27, 0x1E, 0x58, 0x66, 0x27, 0x92 },
+            { 0x38, 0xAA, 0xF8, 0x4E, 0x58, 0x05, 0x6D, 0x8F },
+            { 0x2F, 0xA8, 0xED, 0xD0, 0x94, 0xBA, 0x97, 0xAE },
+            { 0x8B, 0x15, 0x44, 0x2E, 0xE2, 0xDB, 0x61, 0x1A },
+            { 0x91, 0xBF, 0xE3, 0x94, 0x69, 0x73, 0x3A, 0x92 },
+        };
+
+        constexpr uint8_t Bc4ExpectedTexels[][BlockTexelCount] = {
+            { 148, 20, 148, 148, 20, 20, 20, 71, 148, 148, 45, 148, 20, 122, 200, 20 },
+            { 0, 56, 0, 56, 164, 255, 20, 200, 56, 200, 200, 0, 128, 0, 56, 92 },
+            { 216, 216, 190, 177, 177, 164, 190, 255, 190, 203, 230, 216, 0, 203, 177, 203 },
+            { 165, 178, 192, 165, 161, 192, 169, 187, 169, 178, 174, 183, 187, 178, 178, 178 },
+            { 56, 255, 101, 255, 124, 56, 0, 78, 147, 56, 124, 0, 0, 0, 101, 124 },
+            { 143, 143, 95, 47, 143, 168, 143, 119, 71, 255, 0, 95, 168, 143, 95, 143 },
+            { 88, 139, 21, 37, 122, 88, 139, 37, 105, 105, 37, 139, 54, 88, 54, 139 },
+            { 163, 172, 163, 154, 191, 163, 154, 163, 163, 0, 191, 181, 163, 172, 172, 172 },
+        };
+
+        // Random blocks of modes 0 to 7 (in this order).
+        constexpr uint8_t Bc7Blocks[][16] = {
+            { 0x47, 0xD5, 0x8F, 0xA3, 0xC5, 0x50, 0x18, 0x30, 0x03, 0x72, 0x55, 0x5F, 0xD2, 0x35, 0xF1, 0x18 },
+            { 0x2A, 0xFB, 0x38, 0x8C, 0x22, 0xE4, 0x4C, 0xB6, 0x37, 0xF0, 0x12, 0x10, 0xC3, 0x70, 0x7A, 0x90 },
+            { 0xB4, 0x05, 0x42, 0x0F, 0xB1, 0x69, 0x77, 0x9E, 0xDF, 0xB5, 0xB9, 0x34, 0x24, 0x05, 0x15, 0x7F },
+            { 0x58, 0xB1, 0x2E, 0xAE, 0x62, 0xD1, 0x1E, 0x88, 0x7E, 0xB0, 0x76, 0x6D, 0x18, 0x77, 0xF8, 0xC6 },
+            { 0xF0, 0xF2, 0x6B, 0x50, 0x10, 0xAF, 0x31, 0x77, 0xD1, 0x61, 0xE7, 0x95, 0x87, 0xA7, 0x66, 0xEC },
+            { 0x20, 0xE4, 0x03, 0x74, 0x58, 0xA9, 0x90, 0x5C, 0xAD, 0x87, 0xBD, 0x4C, 0x77, 0xE2, 0x98, 0x3F },
+            { 0x40, 0x74, 0x5C, 0xCB, 0x9A, 0x31, 0x05, 0x2E, 0x94, 0x4C, 0xF1, 0xB2, 0x20, 0xEA, 0xA2, 0xC7 },
+            { 0x80, 0x1B, 0x7D, 0x3E, 0x3F, 0x73, 0xF4, 0x14, 0xAF, 0x6E, 0x0D, 0x93, 0x55, 0x20, 0xDD, 0x4C },
+        };
+
+        constexpr uint8_t Bc7ExpectedTexels[][BlockTexelCount] = {
+            { 157, 97, 145, 107, 157, 157, 97, 145, 157, 144, 138, 131, 91, 144, 134, 144 },
+            { 176, 164, 176, 128, 176, 141, 176, 71, 176, 116, 84, 105, 71, 39, 61, 61 },
+            { 109, 167, 167, 118, 118, 167, 167, 128, 128, 167, 167, 128, 194, 194, 194, 135 },
+            { 115, 172, 115, 153, 156, 153, 172, 115, 55, 123, 172, 172, 123, 89, 55, 172 },
+            { 158, 132, 99, 160, 168, 93, 168, 132, 104, 132, 160, 142, 117, 197, 142, 93 },
+            { 135, 135, 135, 88, 88, 159, 159, 88, 111, 88, 135, 135, 111, 135, 111, 111 },
+            { 173, 154, 145, 168, 176, 136, 173, 147, 179, 173, 150, 139, 173, 150, 159, 145 },
+            { 115, 92, 123, 150, 137, 123, 177, 137, 115, 203, 150, 70, 123, 203, 137, 115 },
+        };
+        //! Decodes the blocks laid out in a single block row, clipped to the provided image size.
+        template<size_t BlockCount, size_t BlockSize>
+        void ExpectDecodedWithinTolerance(
+            AZ::RHI::Format format,
+            const uint8_t (&blocks)[BlockCount][BlockSize],
+            const uint8_t (&expectedTexels)[BlockCount][BlockTexelCount],
+            size_t width,
+            size_t height)
+        {
+            ASSERT_LE(width, BlockCount * BlockDim);
+            ASSERT_LE(height, BlockDim);
+
+            const RGL::Utils::LuminanceDecoder* decoder = RGL::Utils::LuminanceDecoder::Find(format);
+            ASSERT_NE(decoder, nullptr);
+            EXPECT_EQ(decoder->GetImageSize(width, height), ((width + BlockDim - 1U) / BlockDim) * BlockSize);
+
+            AZStd::vector<uint8_t> texels(width * height);
+            decoder->Decode(AZStd::span<const uint8_t>(&blocks[0][0], BlockCount * BlockSize), width, height, texels.data());
+            for (size_t y = 0U; y < height; ++y)
+            {
+                for (size_t x = 0U; x < width; ++x)
+                {
+                    const int expected = expectedTexels[x / BlockDim][y * BlockDim + x % BlockDim];
+                    const int actual = texels[y * width + x];
+                    EXPECT_NEAR(actual, expected, LuminanceTolerance) << "Texel (" << x << ", " << y << ")";
+                }
+            }
+        }
+
+        template<size_t BlockCount, size_t BlockSize>
+        void ExpectDecodedWithinTolerance(
+            AZ::RHI::Format format,
+            const uint8_t (&blocks)[BlockCount][BlockSize],
+            const uint8_t (&expectedTexels)[BlockCount][BlockTexelCount])
+        {
+            ExpectDecodedWithinTolerance(format, blocks, expectedTexels, BlockCount * BlockDim, BlockDim);
+        }
+    } // namespace
+
+    TEST(LuminanceDecoderTest, Bc1MatchesReference)
+    {
+        ExpectDecodedWithinTolerance(AZ::RHI::Format::BC1_UNORM, Bc1Blocks, Bc1ExpectedTexels);
+    }
+
+    TEST(LuminanceDecoderTest, Bc3MatchesReference)
+    {
+        ExpectDecodedWithinTolerance(AZ::RHI::Format::BC3_UNORM, Bc3Blocks, Bc3ExpectedTexels);
+    }
+
+    TEST(LuminanceDecoderTest, Bc4MatchesReference)
+    {
+        ExpectDecodedWithinTolerance(AZ::RHI::Format::BC4_UNORM, Bc4Blocks, Bc4ExpectedTexels);
+    }
+
+    TEST(LuminanceDecoderTest, Bc7MatchesReference)
+    {
+        ExpectDecodedWithinTolerance(AZ::RHI::Format::BC7_UNORM, Bc7Blocks, Bc7ExpectedTexels);
+    }
+
+    TEST(LuminanceDecoderTest, BlocksExceedingImageBoundsAreClipped)
+    {
+        ExpectDecodedWithinTolerance(AZ::RHI::Format::BC1_UNORM, Bc1Blocks, Bc1ExpectedTexels, 30U, 3U);
+        ExpectDecodedWithinTolerance(AZ::RHI::Format::BC7_UNORM, Bc7Blocks, Bc7ExpectedTexels, 29U, 1U);
+    }
+
+    TEST(LuminanceDecoderTest, UncompressedFormatsUseLuminanceWeights)
+    {
+        const uint8_t rgbaTexels[] = { 255, 0, 0, 255, 0, 255, 0, 255, 0, 0, 255, 255, 255, 255, 255, 0 };
+        const uint8_t expectedTexels[] = { 76, 149, 28, 255 };
+
+        uint8_t texels[4];
+        const RGL::Utils::LuminanceDecoder* rgbaDecoder = RGL::Utils::LuminanceDecoder::Find(AZ::RHI::Format::R8G8B8A8_UNORM);
+        ASSERT_NE(rgbaDecoder, nullptr);
+        rgbaDecoder->Decode(rgbaTexels, 2U, 2U, texels);
+        EXPECT_THAT(texels, ::testing::ElementsAreArray(expectedTexels));
+
+        // The same texels with swapped red and blue channels.
+        const uint8_t bgraTexels[] = { 0, 0, 255, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 255, 255, 0 };
+        const RGL::Utils::LuminanceDecoder* bgraDecoder = RGL::Utils::LuminanceDecoder::Find(AZ::RHI::Format::B8G8R8A8_UNORM);
+        ASSERT_NE(bgraDecoder, nullptr);
+        bgraDecoder->Decode(bgraTexels, 2U, 2U, texels);
+        EXPECT_THAT(texels, ::testing::ElementsAreArray(expectedTexels));
+    }
+
+    TEST(LuminanceDecoderTest, UnsupportedFormatHasNoDecoder)
+    {
+        EXPECT_EQ(RGL::Utils::LuminanceDecoder::Find(AZ::RHI::Format::BC5_UNORM), nullptr);
+    }
+} // namespace UnitTest
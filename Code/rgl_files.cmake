@@ -14,12 +14,18 @@
 set(FILES
         Source/Entity/ActorEntityManager.cpp
         Source/Entity/ActorEntityManager.h
+        Source/Entity/ColliderEntityManager.cpp
+        Source/Entity/ColliderEntityManager.h
         Source/Entity/MeshEntityManager.cpp
         Source/Entity/MeshEntityManager.h
         Source/Entity/EntityManager.cpp
         Source/Entity/EntityManager.h
+        Source/Entity/EntitySpatialIndex.cpp
+        Source/Entity/EntitySpatialIndex.h
         Source/Entity/MaterialEntityManager.cpp
         Source/Entity/MaterialEntityManager.h
+        Source/Entity/StaticBatcher.cpp
+        Source/Entity/StaticBatcher.h
         Source/Entity/Terrain/TerrainData.cpp
         Source/Entity/Terrain/TerrainData.h
         Source/Entity/Terrain/TerrainEntityManagerSystemComponent.cpp
@@ -34,10 +40,19 @@ set(FILES
         Source/Model/ModelLibraryBus.h
         Source/Model/ModelLibrary.cpp
         Source/Model/ModelLibrary.h
+        Source/Model/TextureLoader.cpp
+        Source/Model/TextureLoader.h
+        Source/RaycastGeometryComponent.cpp
+        Source/RaycastGeometryComponent.h
         Source/RGLSystemComponent.cpp
         Source/RGLSystemComponent.h
         Source/Utilities/RGLUtils.cpp
         Source/Utilities/RGLUtils.h
+        Source/Utilities/RglBufferPool.h
+        Source/Utilities/RglExecutor.cpp
+        Source/Utilities/RglExecutor.h
+        Source/Utilities/TextureDecoding.cpp
+        Source/Utilities/TextureDecoding.h
         Source/Wrappers/RglEntity.cpp
         Source/Wrappers/RglEntity.h
         Source/Wrappers/RglMesh.cpp
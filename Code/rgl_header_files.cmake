@@ -12,6 +12,7 @@
 # See the License for the specific language governing permissions and
 # limitations under the License.
 set(FILES
+        Include/RGL/MemoryUsageBus.h
         Include/RGL/RGLBus.h
         Include/RGL/SceneConfiguration.h
 )